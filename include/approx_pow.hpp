@@ -0,0 +1,419 @@
+//=======================================================================
+// Copyright (c) 2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#ifndef ARTICLES_APPROX_POW
+#define ARTICLES_APPROX_POW
+
+#include <cfloat>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+/*
+ * Without AVX2 at compile-time, GCC can still compile a second version of
+ * approx_pow_n for AVX2 and FMA, it is selected at runtime when the CPU
+ * supports it.
+ */
+#if !defined(__AVX2__) && defined(__SSE2__) && defined(__GNUC__) && !defined(__clang__) && (defined(__x86_64__) || defined(__i386__))
+#define ARTICLES_APPROX_POW_DISPATCH
+#endif
+
+#if defined(__AVX2__) || defined(ARTICLES_APPROX_POW_DISPATCH)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/*!
+ * \brief Precision of approx_pow.
+ *
+ * The relative errors are the ones of the double versions for |y| <= 3. With
+ * float, the rounding of y * log2(x) limits the error to about 1e-6.
+ */
+enum class pow_precision {
+    low,    ///< About 3e-5
+    medium, ///< About 2e-7
+    high    ///< About 3e-14
+};
+
+namespace approx_pow_detail {
+
+template<typename T>
+struct ieee;
+
+template<>
+struct ieee<float> {
+    using bits = uint32_t;
+    static constexpr int mantissa = 23;
+    static constexpr int bias = 127;
+    static constexpr float magic = 12582912.0f;
+};
+
+template<>
+struct ieee<double> {
+    using bits = uint64_t;
+    static constexpr int mantissa = 52;
+    static constexpr int bias = 1023;
+    static constexpr double magic = 6755399441055744.0;
+};
+
+/*
+ * The operations of the kernel on one value or on one SIMD register.
+ *
+ * split(x, e, m) decomposes x = 2^e * m with m in [sqrt(0.5), sqrt(2)],
+ * round(t, k, scale) computes k = round(t) and scale = 2^k and zero(x, r)
+ * returns 0 where x is 0 and r elsewhere.
+ */
+
+template<typename T>
+struct scalar_ops {
+    using vec = T;
+    using bits = typename ieee<T>::bits;
+
+    static constexpr std::size_t size = 1;
+
+    static vec set1(double x){ return vec(x); }
+    static vec load(const T* p){ return *p; }
+    static void store(T* p, vec x){ *p = x; }
+
+    static vec add(vec a, vec b){ return a + b; }
+    static vec sub(vec a, vec b){ return a - b; }
+    static vec mul(vec a, vec b){ return a * b; }
+    static vec fma(vec a, vec b, vec c){ return a * b + c; }
+    static vec div(vec a, vec b){ return a / b; }
+    static vec min(vec a, vec b){ return a < b ? a : b; }
+    static vec max(vec a, vec b){ return a < b ? b : a; }
+    static vec zero(vec x, vec r){ return x == vec(0) ? vec(0) : r; }
+
+    static void split(vec x, vec& e, vec& m){
+        bits b;
+        std::memcpy(&b, &x, sizeof(b));
+
+        int exponent = int(b >> ieee<T>::mantissa) - ieee<T>::bias;
+
+        b = (b & ((bits(1) << ieee<T>::mantissa) - 1)) | (bits(ieee<T>::bias) << ieee<T>::mantissa);
+        std::memcpy(&m, &b, sizeof(b));
+
+        if(m > T(1.4142135623730951)){
+            m *= T(0.5);
+            ++exponent;
+        }
+
+        e = T(exponent);
+    }
+
+    static void round(vec t, vec& k, vec& scale){
+#if FLT_EVAL_METHOD == 0
+        // Adding 1.5 * 2^mantissa rounds to the nearest integer
+        k = (t + ieee<T>::magic) - ieee<T>::magic;
+#else
+        // The magic number does not work with the extended precision of x87
+        k = std::floor(t + T(0.5));
+#endif
+
+        bits b = bits(int(k) + ieee<T>::bias) << ieee<T>::mantissa;
+        std::memcpy(&scale, &b, sizeof(b));
+    }
+};
+
+#if defined(__SSE2__)
+
+struct sse2_float_ops {
+    using vec = __m128;
+
+    static constexpr std::size_t size = 4;
+
+    static vec set1(double x){ return _mm_set1_ps(float(x)); }
+    static vec load(const float* p){ return _mm_loadu_ps(p); }
+    static void store(float* p, vec x){ _mm_storeu_ps(p, x); }
+
+    static vec add(vec a, vec b){ return _mm_add_ps(a, b); }
+    static vec sub(vec a, vec b){ return _mm_sub_ps(a, b); }
+    static vec mul(vec a, vec b){ return _mm_mul_ps(a, b); }
+    static vec fma(vec a, vec b, vec c){ return add(mul(a, b), c); }
+    static vec div(vec a, vec b){ return _mm_div_ps(a, b); }
+    static vec min(vec a, vec b){ return _mm_min_ps(a, b); }
+    static vec max(vec a, vec b){ return _mm_max_ps(a, b); }
+    static vec zero(vec x, vec r){ return _mm_andnot_ps(_mm_cmpeq_ps(x, _mm_setzero_ps()), r); }
+
+    static void split(vec x, vec& e, vec& m){
+        __m128i b = _mm_castps_si128(x);
+
+        __m128i exponent = _mm_sub_epi32(_mm_srli_epi32(b, 23), _mm_set1_epi32(127));
+        m = _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(b, _mm_set1_epi32(0x007FFFFF)), _mm_set1_epi32(0x3F800000)));
+
+        vec above = _mm_cmpgt_ps(m, set1(1.4142135623730951));
+
+        m = _mm_or_ps(_mm_and_ps(above, mul(m, set1(0.5))), _mm_andnot_ps(above, m));
+        e = add(_mm_cvtepi32_ps(exponent), _mm_and_ps(above, set1(1.0)));
+    }
+
+    static void round(vec t, vec& k, vec& scale){
+        __m128i ki = _mm_cvtps_epi32(t);
+
+        k = _mm_cvtepi32_ps(ki);
+        scale = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(ki, _mm_set1_epi32(127)), 23));
+    }
+};
+
+struct sse2_double_ops {
+    using vec = __m128d;
+
+    static constexpr std::size_t size = 2;
+
+    static vec set1(double x){ return _mm_set1_pd(x); }
+    static vec load(const double* p){ return _mm_loadu_pd(p); }
+    static void store(double* p, vec x){ _mm_storeu_pd(p, x); }
+
+    static vec add(vec a, vec b){ return _mm_add_pd(a, b); }
+    static vec sub(vec a, vec b){ return _mm_sub_pd(a, b); }
+    static vec mul(vec a, vec b){ return _mm_mul_pd(a, b); }
+    static vec fma(vec a, vec b, vec c){ return add(mul(a, b), c); }
+    static vec div(vec a, vec b){ return _mm_div_pd(a, b); }
+    static vec min(vec a, vec b){ return _mm_min_pd(a, b); }
+    static vec max(vec a, vec b){ return _mm_max_pd(a, b); }
+    static vec zero(vec x, vec r){ return _mm_andnot_pd(_mm_cmpeq_pd(x, _mm_setzero_pd()), r); }
+
+    // Adding 2^52 + 2^51 converts between small integers and doubles
+    static vec magic(){ return set1(6755399441055744.0); }
+
+    static void split(vec x, vec& e, vec& m){
+        __m128i b = _mm_castpd_si128(x);
+
+        __m128i exponent = _mm_sub_epi64(_mm_srli_epi64(b, 52), _mm_set1_epi64x(1023));
+        m = _mm_castsi128_pd(_mm_or_si128(_mm_and_si128(b, _mm_set1_epi64x(0x000FFFFFFFFFFFFFLL)), _mm_set1_epi64x(0x3FF0000000000000LL)));
+
+        vec above = _mm_cmpgt_pd(m, set1(1.4142135623730951));
+
+        m = _mm_or_pd(_mm_and_pd(above, mul(m, set1(0.5))), _mm_andnot_pd(above, m));
+        e = sub(_mm_castsi128_pd(_mm_add_epi64(exponent, _mm_castpd_si128(magic()))), magic());
+        e = add(e, _mm_and_pd(above, set1(1.0)));
+    }
+
+    static void round(vec t, vec& k, vec& scale){
+        vec shifted = add(t, magic());
+        __m128i ki = _mm_sub_epi64(_mm_castpd_si128(shifted), _mm_castpd_si128(magic()));
+
+        k = sub(shifted, magic());
+        scale = _mm_castsi128_pd(_mm_slli_epi64(_mm_add_epi64(ki, _mm_set1_epi64x(1023)), 52));
+    }
+};
+
+template<typename T>
+struct sse2_ops;
+
+template<>
+struct sse2_ops<float> {
+    using type = sse2_float_ops;
+};
+
+template<>
+struct sse2_ops<double> {
+    using type = sse2_double_ops;
+};
+
+#endif
+
+} //end of namespace approx_pow_detail
+
+#if defined(ARTICLES_APPROX_POW_DISPATCH)
+#pragma GCC push_options
+#pragma GCC target("avx2,fma")
+#endif
+
+#if defined(__AVX2__) || defined(ARTICLES_APPROX_POW_DISPATCH)
+
+namespace approx_pow_detail {
+
+#if defined(__FMA__) || defined(ARTICLES_APPROX_POW_DISPATCH)
+#define ARTICLES_AVX2_FMA(fused, separate) fused
+#else
+#define ARTICLES_AVX2_FMA(fused, separate) separate
+#endif
+
+struct avx2_float_ops {
+    using vec = __m256;
+
+    static constexpr std::size_t size = 8;
+
+    static vec set1(double x){ return _mm256_set1_ps(float(x)); }
+    static vec load(const float* p){ return _mm256_loadu_ps(p); }
+    static void store(float* p, vec x){ _mm256_storeu_ps(p, x); }
+
+    static vec add(vec a, vec b){ return _mm256_add_ps(a, b); }
+    static vec sub(vec a, vec b){ return _mm256_sub_ps(a, b); }
+    static vec mul(vec a, vec b){ return _mm256_mul_ps(a, b); }
+    static vec fma(vec a, vec b, vec c){ return ARTICLES_AVX2_FMA(_mm256_fmadd_ps(a, b, c), add(mul(a, b), c)); }
+    static vec div(vec a, vec b){ return _mm256_div_ps(a, b); }
+    static vec min(vec a, vec b){ return _mm256_min_ps(a, b); }
+    static vec max(vec a, vec b){ return _mm256_max_ps(a, b); }
+    static vec zero(vec x, vec r){ return _mm256_andnot_ps(_mm256_cmp_ps(x, _mm256_setzero_ps(), _CMP_EQ_OQ), r); }
+
+    static void split(vec x, vec& e, vec& m){
+        __m256i b = _mm256_castps_si256(x);
+
+        __m256i exponent = _mm256_sub_epi32(_mm256_srli_epi32(b, 23), _mm256_set1_epi32(127));
+        m = _mm256_castsi256_ps(_mm256_or_si256(_mm256_and_si256(b, _mm256_set1_epi32(0x007FFFFF)), _mm256_set1_epi32(0x3F800000)));
+
+        vec above = _mm256_cmp_ps(m, set1(1.4142135623730951), _CMP_GT_OQ);
+
+        m = _mm256_blendv_ps(m, mul(m, set1(0.5)), above);
+        e = add(_mm256_cvtepi32_ps(exponent), _mm256_and_ps(above, set1(1.0)));
+    }
+
+    static void round(vec t, vec& k, vec& scale){
+        __m256i ki = _mm256_cvtps_epi32(t);
+
+        k = _mm256_cvtepi32_ps(ki);
+        scale = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(ki, _mm256_set1_epi32(127)), 23));
+    }
+};
+
+struct avx2_double_ops {
+    using vec = __m256d;
+
+    static constexpr std::size_t size = 4;
+
+    static vec set1(double x){ return _mm256_set1_pd(x); }
+    static vec load(const double* p){ return _mm256_loadu_pd(p); }
+    static void store(double* p, vec x){ _mm256_storeu_pd(p, x); }
+
+    static vec add(vec a, vec b){ return _mm256_add_pd(a, b); }
+    static vec sub(vec a, vec b){ return _mm256_sub_pd(a, b); }
+    static vec mul(vec a, vec b){ return _mm256_mul_pd(a, b); }
+    static vec fma(vec a, vec b, vec c){ return ARTICLES_AVX2_FMA(_mm256_fmadd_pd(a, b, c), add(mul(a, b), c)); }
+    static vec div(vec a, vec b){ return _mm256_div_pd(a, b); }
+    static vec min(vec a, vec b){ return _mm256_min_pd(a, b); }
+    static vec max(vec a, vec b){ return _mm256_max_pd(a, b); }
+    static vec zero(vec x, vec r){ return _mm256_andnot_pd(_mm256_cmp_pd(x, _mm256_setzero_pd(), _CMP_EQ_OQ), r); }
+
+    // Adding 2^52 + 2^51 converts between small integers and doubles
+    static vec magic(){ return set1(6755399441055744.0); }
+
+    static void split(vec x, vec& e, vec& m){
+        __m256i b = _mm256_castpd_si256(x);
+
+        __m256i exponent = _mm256_sub_epi64(_mm256_srli_epi64(b, 52), _mm256_set1_epi64x(1023));
+        m = _mm256_castsi256_pd(_mm256_or_si256(_mm256_and_si256(b, _mm256_set1_epi64x(0x000FFFFFFFFFFFFFLL)), _mm256_set1_epi64x(0x3FF0000000000000LL)));
+
+        vec above = _mm256_cmp_pd(m, set1(1.4142135623730951), _CMP_GT_OQ);
+
+        m = _mm256_blendv_pd(m, mul(m, set1(0.5)), above);
+        e = sub(_mm256_castsi256_pd(_mm256_add_epi64(exponent, _mm256_castpd_si256(magic()))), magic());
+        e = add(e, _mm256_and_pd(above, set1(1.0)));
+    }
+
+    static void round(vec t, vec& k, vec& scale){
+        vec shifted = add(t, magic());
+        __m256i ki = _mm256_sub_epi64(_mm256_castpd_si256(shifted), _mm256_castpd_si256(magic()));
+
+        k = sub(shifted, magic());
+        scale = _mm256_castsi256_pd(_mm256_slli_epi64(_mm256_add_epi64(ki, _mm256_set1_epi64x(1023)), 52));
+    }
+};
+
+template<typename T>
+struct avx2_ops;
+
+template<>
+struct avx2_ops<float> {
+    using type = avx2_float_ops;
+};
+
+template<>
+struct avx2_ops<double> {
+    using type = avx2_double_ops;
+};
+
+#if defined(ARTICLES_APPROX_POW_DISPATCH)
+
+// All the functions of the kernel are compiled for AVX2 and FMA
+namespace avx2 {
+#include "approx_pow_kernel.hpp"
+} //end of namespace avx2
+
+#endif
+
+} //end of namespace approx_pow_detail
+
+#endif
+
+#if defined(ARTICLES_APPROX_POW_DISPATCH)
+#pragma GCC pop_options
+#endif
+
+namespace approx_pow_detail {
+
+// The operations selected at compile-time
+#if defined(__AVX2__)
+
+template<typename T>
+struct simd_ops : avx2_ops<T> {};
+
+#elif defined(__SSE2__)
+
+template<typename T>
+struct simd_ops : sse2_ops<T> {};
+
+#else
+
+template<typename T>
+struct simd_ops {
+    using type = scalar_ops<T>;
+};
+
+#endif
+
+#include "approx_pow_kernel.hpp"
+
+#if defined(ARTICLES_APPROX_POW_DISPATCH)
+
+inline bool has_avx2_fma(){
+    static const bool supported = []{
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+    }();
+
+    return supported;
+}
+
+#endif
+
+} //end of namespace approx_pow_detail
+
+/*!
+ * \brief Compute an approximation of x^y, with polynomial approximations of
+ * log2 and exp2.
+ *
+ * x must be zero or a positive normal number. The result is exactly 0 for
+ * x == 0, the other results saturate instead of overflowing to infinity or
+ * underflowing to zero.
+ */
+template<pow_precision P = pow_precision::medium, typename T>
+inline T approx_pow(T x, T y){
+    return approx_pow_detail::kernel<P, T, approx_pow_detail::scalar_ops<T>>(x, y);
+}
+
+/*!
+ * \brief Compute out[i] = approx_pow(x[i], y) for len elements, with SSE2 or
+ * AVX2 when available. Without AVX2 at compile-time, the AVX2 and FMA version
+ * is still used when the CPU supports it.
+ */
+template<pow_precision P = pow_precision::medium, typename T>
+inline void approx_pow_n(const T* x, T* out, std::size_t len, T y){
+#if defined(ARTICLES_APPROX_POW_DISPATCH)
+    if(approx_pow_detail::has_avx2_fma()){
+        approx_pow_detail::avx2::approx_pow_n<P, T, typename approx_pow_detail::avx2_ops<T>::type>(x, out, len, y);
+        return;
+    }
+#endif
+
+    approx_pow_detail::approx_pow_n<P, T, typename approx_pow_detail::simd_ops<T>::type>(x, out, len, y);
+}
+
+#endif
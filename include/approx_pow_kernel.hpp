@@ -0,0 +1,113 @@
+//=======================================================================
+// Copyright (c) 2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*
+ * The kernel of approx_pow, included by approx_pow.hpp in approx_pow_detail
+ * and, for the runtime dispatch, a second time in approx_pow_detail::avx2
+ * where it is compiled for AVX2 and FMA. There is no include guard.
+ */
+
+template<typename Ops>
+typename Ops::vec horner(typename Ops::vec, double c){
+    return Ops::set1(c);
+}
+
+template<typename Ops, typename... C>
+typename Ops::vec horner(typename Ops::vec x, double c, C... rest){
+    return Ops::fma(horner<Ops>(x, rest...), x, Ops::set1(c));
+}
+
+/*
+ * Coefficients of the polynomials, interpolated at the Chebyshev nodes:
+ *  - log2(m) = s * P(s^2) with s = (m - 1) / (m + 1) and m in [sqrt(0.5), sqrt(2)]
+ *  - exp2(f) = Q(f) with f in [-0.5, 0.5]
+ */
+
+template<pow_precision P>
+struct tier;
+
+template<>
+struct tier<pow_precision::low> {
+    template<typename Ops>
+    static typename Ops::vec log2(typename Ops::vec z){
+        return horner<Ops>(z, 2.8853262320521393, 0.9791030896510511);
+    }
+
+    template<typename Ops>
+    static typename Ops::vec exp2(typename Ops::vec f){
+        return horner<Ops>(f, 0.9999999999999998, 0.693121045203427, 0.24022349038020335, 0.055921975842256264,
+            0.009666368515387469);
+    }
+};
+
+template<>
+struct tier<pow_precision::medium> {
+    template<typename Ops>
+    static typename Ops::vec log2(typename Ops::vec z){
+        return horner<Ops>(z, 2.8853904219618323, 0.9615889466940929, 0.5957596069010724);
+    }
+
+    template<typename Ops>
+    static typename Ops::vec exp2(typename Ops::vec f){
+        return horner<Ops>(f, 1.0000000754548972, 0.6931471880262287, 0.24022107485308267, 0.05550357114219182,
+            0.009676031918324862, 0.0013390863364620869);
+    }
+};
+
+template<>
+struct tier<pow_precision::high> {
+    template<typename Ops>
+    static typename Ops::vec log2(typename Ops::vec z){
+        return horner<Ops>(z, 2.8853900817778437, 0.9617966941173314, 0.5770779417748686, 0.41220928871768237,
+            0.31990469704674773, 0.2829102371320172);
+    }
+
+    template<typename Ops>
+    static typename Ops::vec exp2(typename Ops::vec f){
+        return horner<Ops>(f, 0.9999999999999999, 0.6931471805599503, 0.2402265069591137, 0.05550410866444462,
+            0.009618129107325204, 0.001333355823059498, 0.00015403530684891632, 1.5252657001585593e-05,
+            1.3215351669880077e-06, 1.0208738433454733e-07, 7.084937109308047e-09);
+    }
+};
+
+// x^y = 2^(y * log2(x))
+template<pow_precision P, typename T, typename Ops>
+typename Ops::vec kernel(typename Ops::vec x, typename Ops::vec y){
+    using vec = typename Ops::vec;
+
+    vec e, m;
+    Ops::split(x, e, m);
+
+    vec one = Ops::set1(1.0);
+    vec s = Ops::div(Ops::sub(m, one), Ops::add(m, one));
+    vec log2 = Ops::add(e, Ops::mul(s, tier<P>::template log2<Ops>(Ops::mul(s, s))));
+
+    // Keep the power of two in the range of the normal numbers
+    vec t = Ops::mul(y, log2);
+    t = Ops::max(t, Ops::set1(1 - ieee<T>::bias));
+    t = Ops::min(t, Ops::set1(ieee<T>::bias));
+
+    vec k, scale;
+    Ops::round(t, k, scale);
+
+    return Ops::zero(x, Ops::mul(tier<P>::template exp2<Ops>(Ops::sub(t, k)), scale));
+}
+
+template<pow_precision P, typename T, typename Ops>
+inline void approx_pow_n(const T* x, T* out, std::size_t len, T y){
+    auto vy = Ops::set1(y);
+
+    std::size_t vectorized = len - len % Ops::size;
+
+    for(std::size_t i = 0; i < vectorized; i += Ops::size){
+        Ops::store(out + i, kernel<P, T, Ops>(Ops::load(x + i), vy));
+    }
+
+    for(std::size_t i = vectorized; i < len; ++i){
+        out[i] = kernel<P, T, scalar_ops<T>>(x[i], y);
+    }
+}
@@ -0,0 +1,145 @@
+//=======================================================================
+// Copyright (c) 2015 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#ifndef ARTICLES_ARENA_ALLOCATOR
+#define ARTICLES_ARENA_ALLOCATOR
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <vector>
+
+namespace arena_detail {
+
+/*!
+ * \brief Monotonic memory arena: the allocations are taken from large chunks
+ * and are only given back when all of them have been freed, except for the
+ * last one which can be taken back immediately.
+ */
+class arena {
+public:
+    static constexpr const std::size_t chunk_size = 1 << 20;
+
+    arena() = default;
+
+    arena(const arena&) = delete;
+    arena& operator=(const arena&) = delete;
+
+    ~arena(){
+        for(auto& chunk : chunks){
+            ::operator delete(chunk.memory);
+        }
+    }
+
+    void* allocate(std::size_t bytes, std::size_t alignment){
+        if(chunks.empty()){
+            add_chunk(bytes + alignment);
+        }
+
+        char* memory = aligned(chunks[current].memory + top, alignment);
+
+        if(memory + bytes > chunks[current].memory + chunks[current].size){
+            // The next chunk is only reused if it is large enough
+            if(current + 1 < chunks.size() && chunks[current + 1].size >= bytes + alignment){
+                ++current;
+            } else {
+                add_chunk(bytes + alignment);
+                current = chunks.size() - 1;
+            }
+
+            memory = aligned(chunks[current].memory, alignment);
+        }
+
+        top = memory + bytes - chunks[current].memory;
+        ++live;
+
+        return memory;
+    }
+
+    void deallocate(void* p, std::size_t bytes){
+        char* memory = static_cast<char*>(p);
+
+        if(memory + bytes == chunks[current].memory + top){
+            top = memory - chunks[current].memory;
+        }
+
+        // Once everything has been freed, the chunks are reused from the start
+        if(--live == 0){
+            current = 0;
+            top = 0;
+        }
+    }
+
+private:
+    struct chunk {
+        char* memory;
+        std::size_t size;
+    };
+
+    std::vector<chunk> chunks;
+    std::size_t current = 0; ///< The chunk the allocations are taken from
+    std::size_t top = 0;     ///< The first free byte of the current chunk
+    std::size_t live = 0;    ///< The number of allocations not yet freed
+
+    static char* aligned(char* memory, std::size_t alignment){
+        auto address = reinterpret_cast<std::uintptr_t>(memory);
+        return memory + (alignment - address % alignment) % alignment;
+    }
+
+    void add_chunk(std::size_t bytes){
+        std::size_t size = bytes;
+        if(size < chunk_size){
+            size = chunk_size;
+        }
+
+        chunks.push_back({static_cast<char*>(::operator new(size)), size});
+    }
+};
+
+//! The arena of the current thread
+inline arena& local_arena(){
+    static thread_local arena instance;
+    return instance;
+}
+
+} //end of namespace arena_detail
+
+/*!
+ * \brief Stateless allocator taking its memory from the arena of the current
+ * thread.
+ *
+ * The memory must be freed by the thread that allocated it.
+ */
+template<typename T>
+struct arena_allocator {
+    using value_type = T;
+
+    arena_allocator() = default;
+
+    template<typename U>
+    arena_allocator(const arena_allocator<U>&){}
+
+    T* allocate(std::size_t n){
+        return static_cast<T*>(arena_detail::local_arena().allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T* p, std::size_t n){
+        arena_detail::local_arena().deallocate(p, n * sizeof(T));
+    }
+};
+
+template<typename T, typename U>
+bool operator==(const arena_allocator<T>&, const arena_allocator<U>&){
+    return true;
+}
+
+template<typename T, typename U>
+bool operator!=(const arena_allocator<T>&, const arena_allocator<U>&){
+    return false;
+}
+
+#endif
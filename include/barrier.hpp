@@ -0,0 +1,53 @@
+//=======================================================================
+// Copyright (c) 2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#ifndef ARTICLES_BARRIER
+#define ARTICLES_BARRIER
+
+#include <atomic>
+#include <type_traits>
+
+/*!
+ * \brief Force the compiler to compute the value, as if it was read by an
+ * unknown function, without any cost at runtime.
+ *
+ * The values that do not fit in a register are only passed in memory, the
+ * compiler would make a copy otherwise.
+ */
+template<typename T>
+inline typename std::enable_if<std::is_trivially_copyable<T>::value && sizeof(T) <= sizeof(void*)>::type do_not_optimize(const T& value){
+#if defined(__GNUC__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static const T* volatile sink;
+    sink = &value;
+#endif
+}
+
+template<typename T>
+inline typename std::enable_if<!(std::is_trivially_copyable<T>::value && sizeof(T) <= sizeof(void*))>::type do_not_optimize(const T& value){
+#if defined(__GNUC__)
+    asm volatile("" : : "m"(value) : "memory");
+#else
+    static const T* volatile sink;
+    sink = &value;
+#endif
+}
+
+/*!
+ * \brief Force the compiler to complete the pending writes to memory, as if
+ * all the memory reachable by an unknown function was read and written.
+ */
+inline void clobber_memory(){
+#if defined(__GNUC__)
+    asm volatile("" : : : "memory");
+#else
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+}
+
+#endif
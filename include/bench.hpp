@@ -7,8 +7,10 @@
 
 #include <chrono>
 
+#include "barrier.hpp"
 #include "graphs.hpp"
 #include "demangle.hpp"
+#include "timer.hpp"
 
 // chrono typedefs
 
@@ -49,12 +51,18 @@ void bench(const std::string& type, const std::initializer_list<int> &sizes){
         for(std::size_t i=0; i<REPEAT; ++i) {
             auto container = CreatePolicy<Container>::make(size);
 
+            // The tests cannot assume anything about the container
+            do_not_optimize(container);
+
             Clock::time_point t0 = Clock::now();
 
             run<TestPolicy...>(container, size);
 
+            // All the modifications of the container must be done
+            clobber_memory();
+
             Clock::time_point t1 = Clock::now();
-            duration += std::chrono::duration_cast<DurationUnit>(t1 - t0).count();
+            duration += elapsed<DurationUnit>(t0, t1);
         }
 
         graphs::new_result(type, std::to_string(size), duration / REPEAT);
@@ -0,0 +1,219 @@
+//=======================================================================
+// Copyright (c) 2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#ifndef ARTICLES_COMPILE_BENCH
+#define ARTICLES_COMPILE_BENCH
+
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "graphs.hpp"
+
+#ifndef COMPILE_BENCH_CXX
+#define COMPILE_BENCH_CXX "c++"
+#endif
+
+#ifndef COMPILE_BENCH_ROOT
+#define COMPILE_BENCH_ROOT "."
+#endif
+
+/*
+ * Measure the cost of compiling a source file: the wall time, the peak memory
+ * of the compiler and the time spent in template instantiation, as reported by
+ * -ftime-report.
+ */
+
+namespace compile_bench {
+
+struct measure {
+    std::size_t time;          ///< Wall time, in milliseconds
+    std::size_t memory;        ///< Peak memory of the compiler, in KB
+    std::size_t instantiation; ///< Template instantiation wall time, in milliseconds
+};
+
+//! Return the command compiling source without linking it
+inline std::vector<std::string> command(const std::string& source, const std::vector<std::string>& flags){
+    std::vector<std::string> args = {COMPILE_BENCH_CXX, "-I" COMPILE_BENCH_ROOT "/include", "-c", source, "-o", "/dev/null"};
+    args.insert(args.end(), flags.begin(), flags.end());
+    return args;
+}
+
+/*!
+ * \brief Run the command once, the diagnostics of the compiler are stored in
+ * output. Return false if the compiler failed.
+ */
+inline bool run(std::vector<std::string> args, measure& result, std::string& output){
+    std::vector<char*> argv;
+    for(auto& arg : args){
+        argv.push_back(&arg[0]);
+    }
+    argv.push_back(nullptr);
+
+    int fds[2];
+    if(pipe(fds) != 0){
+        return false;
+    }
+
+    auto t0 = std::chrono::steady_clock::now();
+
+    pid_t pid = fork();
+
+    if(pid == 0){
+        close(fds[0]);
+        dup2(fds[1], STDERR_FILENO);
+        close(fds[1]);
+        execvp(argv[0], argv.data());
+        _exit(127);
+    }
+
+    close(fds[1]);
+
+    // The pipe must be emptied before waiting, the compiler could block on it
+    char buffer[4096];
+    ssize_t n;
+    output.clear();
+    while((n = read(fds[0], buffer, sizeof(buffer))) > 0){
+        output.append(buffer, n);
+    }
+    close(fds[0]);
+
+    int status = 0;
+    struct rusage usage;
+
+    if(pid < 0 || wait4(pid, &status, 0, &usage) != pid){
+        return false;
+    }
+
+    auto t1 = std::chrono::steady_clock::now();
+
+    // The usage includes the compiler proper, started by the driver
+    result.time = std::chrono::duration_cast<std::chrono::milliseconds>(t1 - t0).count();
+    result.memory = usage.ru_maxrss;
+
+    return WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+
+//! Extract the template instantiation wall time from the output of -ftime-report
+inline std::size_t instantiation_time(const std::string& report){
+    std::istringstream stream(report);
+    std::string line;
+
+    while(std::getline(stream, line)){
+        if(line.find("template instantiation") == std::string::npos){
+            continue;
+        }
+
+        // usr, sys and wall, each one followed by its percentage
+        std::istringstream columns(line.substr(line.find(':') + 1));
+        double seconds = 0;
+        std::string percent;
+
+        for(std::size_t i = 0; i < 3 && (columns >> seconds); ++i){
+            columns >> percent;
+            if(percent == "("){
+                columns >> percent;
+            }
+        }
+
+        return std::size_t(seconds * 1000.0);
+    }
+
+    return 0;
+}
+
+/*!
+ * \brief Best of repeat compilations, followed by one more compilation with
+ * -ftime-report to get the instantiation time. All the measures are zero if
+ * the compiler fails.
+ */
+inline measure bench(const std::string& source, const std::vector<std::string>& flags, std::size_t repeat = 3){
+    measure best = {0, 0, 0};
+    std::string output;
+
+    for(std::size_t i = 0; i < repeat; ++i){
+        measure current;
+
+        if(!run(command(source, flags), current, output)){
+            std::cerr << source << " failed to compile:" << std::endl << output << std::endl;
+            return {0, 0, 0};
+        }
+
+        if(i == 0 || current.time < best.time){
+            best.time = current.time;
+        }
+
+        if(i == 0 || current.memory < best.memory){
+            best.memory = current.memory;
+        }
+    }
+
+    auto flags_report = flags;
+    flags_report.push_back("-ftime-report");
+
+    measure report;
+    if(run(command(source, flags_report), report, output)){
+        best.instantiation = instantiation_time(output);
+    }
+
+    return best;
+}
+
+//! Write a generated source file in the temporary directory, return its path
+inline std::string write_source(const std::string& name, const std::string& content){
+    const char* tmp = std::getenv("TMPDIR");
+    std::string path = std::string(tmp ? tmp : "/tmp") + "/" + name + "_" + std::to_string(getpid()) + ".cpp";
+
+    std::ofstream file(path);
+    file << content;
+
+    return path;
+}
+
+/*!
+ * \brief Create the time, memory and instantiation graphs, the groups are the
+ * sizes and results[i][j] is the measure of series[i] for sizes[j].
+ */
+inline void output_graphs(const std::string& name, const std::string& title, const std::vector<std::string>& series,
+                          const std::vector<std::size_t>& sizes, const std::vector<std::vector<measure>>& results){
+    graphs::new_graph(name + "_time", "Compile time of " + title, "ms");
+
+    for(std::size_t i = 0; i < series.size(); ++i){
+        for(std::size_t j = 0; j < sizes.size(); ++j){
+            graphs::new_result(series[i], std::to_string(sizes[j]), results[i][j].time);
+        }
+    }
+
+    graphs::new_graph(name + "_memory", "Compiler memory for " + title, "KB");
+
+    for(std::size_t i = 0; i < series.size(); ++i){
+        for(std::size_t j = 0; j < sizes.size(); ++j){
+            graphs::new_result(series[i], std::to_string(sizes[j]), results[i][j].memory);
+        }
+    }
+
+    graphs::new_graph(name + "_instantiation", "Template instantiation time of " + title, "ms");
+
+    for(std::size_t i = 0; i < series.size(); ++i){
+        for(std::size_t j = 0; j < sizes.size(); ++j){
+            graphs::new_result(series[i], std::to_string(sizes[j]), results[i][j].instantiation);
+        }
+    }
+}
+
+} //end of namespace compile_bench
+
+#endif
@@ -0,0 +1,341 @@
+//=======================================================================
+// Copyright (c) 2014 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+// Concurrent benchmarking procedure, needs C++14 for the reader-writer lock
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <shared_mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Single operations done by the threads, on the element with the given key
+
+template<class Container>
+inline bool find_key(Container& c, std::size_t key){
+    // hand written comparison to eliminate temporary object creation
+    return std::find_if(std::begin(c), std::end(c), [&](decltype(*std::begin(c)) v){ return v.a == key; }) != std::end(c);
+}
+
+template<class Container>
+inline void write_key(Container& c, std::size_t key){
+    auto it = std::find_if(std::begin(c), std::end(c), [&](decltype(*std::begin(c)) v){ return v.a == key; });
+    if(it != std::end(c)){
+        *it = typename Container::value_type{key};
+    }
+}
+
+template<class Container>
+inline void insert_key(Container& c, std::size_t key){
+    c.insert(std::find_if(std::begin(c), std::end(c), [&](decltype(*std::begin(c)) v){ return v.a >= key; }), {key});
+}
+
+// Synchronization strategies, holding the shared data
+
+template<class Container>
+struct global_mutex {
+    Container container;
+    std::mutex mutex;
+
+    explicit global_mutex(std::size_t size) : container(FilledRandom<Container>::make(size)) {}
+
+    template<typename Functor>
+    void read(std::size_t, Functor functor){
+        std::lock_guard<std::mutex> lock(mutex);
+        functor(container);
+    }
+
+    template<typename Functor>
+    void write(std::size_t, Functor functor){
+        std::lock_guard<std::mutex> lock(mutex);
+        functor(container);
+    }
+
+    static void clean(){
+        FilledRandom<Container>::clean();
+    }
+};
+
+template<class Container>
+struct rw_lock {
+    Container container;
+    std::shared_timed_mutex mutex;
+
+    explicit rw_lock(std::size_t size) : container(FilledRandom<Container>::make(size)) {}
+
+    template<typename Functor>
+    void read(std::size_t, Functor functor){
+        std::shared_lock<std::shared_timed_mutex> lock(mutex);
+        functor(container);
+    }
+
+    template<typename Functor>
+    void write(std::size_t, Functor functor){
+        std::unique_lock<std::shared_timed_mutex> lock(mutex);
+        functor(container);
+    }
+
+    static void clean(){
+        FilledRandom<Container>::clean();
+    }
+};
+
+// The elements are distributed in several containers by key, each with its
+// own lock
+template<class Container>
+struct sharded {
+    static const std::size_t shards = 16;
+
+    std::array<Container, shards> containers;
+    std::array<std::mutex, shards> mutexes;
+
+    explicit sharded(std::size_t size){
+        for(auto& value : FilledRandom<Container>::make(size)){
+            containers[value.a % shards].push_back(value);
+        }
+    }
+
+    template<typename Functor>
+    void read(std::size_t key, Functor functor){
+        std::lock_guard<std::mutex> lock(mutexes[key % shards]);
+        functor(containers[key % shards]);
+    }
+
+    template<typename Functor>
+    void write(std::size_t key, Functor functor){
+        std::lock_guard<std::mutex> lock(mutexes[key % shards]);
+        functor(containers[key % shards]);
+    }
+
+    static void clean(){
+        FilledRandom<Container>::clean();
+    }
+};
+
+template<class Container>
+const std::size_t sharded<Container>::shards;
+
+// Percentages of find, write and insert operations
+
+template<std::size_t Find, std::size_t Write, std::size_t Insert>
+struct mix {
+    static_assert(Find + Write + Insert == 100, "The mix must sum to 100%");
+
+    static const std::size_t find = Find;
+    static const std::size_t write = Write;
+    static const std::size_t insert = Insert;
+};
+
+// Number of operations done by each thread
+
+static const std::size_t OPERATIONS = 2000;
+
+// Run OPERATIONS operations of the mix in each thread on a shared container of
+// the given size and record the throughput (operations per millisecond) for
+// each number of threads
+
+template<typename Container,
+         template<class> class Strategy,
+         typename Mix>
+void bench_concurrent(const std::string& type, std::size_t size, const std::initializer_list<int> &threads){
+    for(auto thread_count : threads) {
+        std::size_t throughput = 0;
+
+        for(std::size_t i=0; i<REPEAT; ++i) {
+            Strategy<Container> shared(size);
+
+            std::atomic<bool> start(false);
+            std::atomic<std::size_t> ready(0);
+            std::atomic<std::size_t> misses(0);
+
+            std::vector<std::thread> workers;
+
+            for(int t = 0; t < thread_count; ++t){
+                workers.push_back(std::thread([&, t](){
+                    std::mt19937 generator(t);
+                    std::uniform_int_distribution<std::size_t> operation_distribution(0, 99);
+                    std::uniform_int_distribution<std::size_t> key_distribution(0, size - 1);
+
+                    std::size_t local_misses = 0;
+
+                    ++ready;
+                    while(!start){
+                        std::this_thread::yield();
+                    }
+
+                    for(std::size_t o = 0; o < OPERATIONS; ++o){
+                        auto operation = operation_distribution(generator);
+                        auto key = key_distribution(generator);
+
+                        if(operation < Mix::find){
+                            shared.read(key, [&](Container& c){ local_misses += !find_key(c, key); });
+                        } else if(operation < Mix::find + Mix::write){
+                            shared.write(key, [&](Container& c){ write_key(c, key); });
+                        } else {
+                            shared.write(key, [&](Container& c){ insert_key(c, key); });
+                        }
+                    }
+
+                    misses += local_misses;
+                }));
+            }
+
+            while(ready != static_cast<std::size_t>(thread_count)){
+                std::this_thread::yield();
+            }
+
+            Clock::time_point t0 = Clock::now();
+
+            start = true;
+
+            for(auto& worker : workers){
+                worker.join();
+            }
+
+            Clock::time_point t1 = Clock::now();
+
+            auto us = std::chrono::duration_cast<microseconds>(t1 - t0).count();
+            throughput += (thread_count * OPERATIONS * 1000) / (us ? us : 1);
+
+            // All the keys are present
+            if(misses){
+                std::cout << "Error: " << misses << " keys not found" << std::endl;
+            }
+        }
+
+        graphs::new_result(type, std::to_string(thread_count), throughput / REPEAT);
+    }
+
+    Strategy<Container>::clean();
+}
+
+// Containers shared by several producers behind a single mutex, each producer
+// keeps a pointer to the elements it inserted
+
+template<class T>
+inline T* insert_back(plf::colony<T>& c, const T& value){
+    return &*c.insert(value);
+}
+
+template<class T>
+inline T* insert_back(std::deque<T>& c, const T& value){
+    c.push_back(value);
+    return &c.back();
+}
+
+template<class T>
+inline void erase_pointer(plf::colony<T>& c, T* element){
+    c.erase(c.get_iterator_from_pointer(element));
+}
+
+template<class Container>
+struct mutex_producers {
+    using value_type = typename Container::value_type;
+
+    Container container;
+    std::mutex mutex;
+
+    struct producer {
+        mutex_producers* shared;
+
+        value_type* insert(const value_type& value){
+            std::lock_guard<std::mutex> lock(shared->mutex);
+            return insert_back(shared->container, value);
+        }
+
+        void erase(value_type* element){
+            std::lock_guard<std::mutex> lock(shared->mutex);
+            erase_pointer(shared->container, element);
+        }
+    };
+
+    producer make_producer(){
+        return {this};
+    }
+};
+
+// Erasure by a producer, only done by the benchmarks with erasures
+
+template<typename Producer, typename Element>
+inline void erase_produced(Producer& producer, Element element, std::true_type){
+    producer.erase(element);
+}
+
+template<typename Producer, typename Element>
+inline void erase_produced(Producer&, Element, std::false_type){}
+
+// Number of insertions done by each producer
+
+static const std::size_t PRODUCTIONS = 20000;
+
+// Each thread inserts PRODUCTIONS elements in the shared container through its
+// own producer and, with Erase, erases one of every four elements it inserted.
+// Record the throughput (insertions per millisecond) for each number of threads
+
+template<typename Shared, bool Erase>
+void bench_producers(const std::string& type, const std::initializer_list<int> &threads){
+    using value_type = typename Shared::value_type;
+
+    for(auto thread_count : threads) {
+        std::size_t throughput = 0;
+
+        for(std::size_t i=0; i<REPEAT; ++i) {
+            std::unique_ptr<Shared> shared(new Shared());
+
+            std::atomic<bool> start(false);
+            std::atomic<std::size_t> ready(0);
+
+            std::vector<std::thread> workers;
+
+            for(int t = 0; t < thread_count; ++t){
+                workers.push_back(std::thread([&](){
+                    auto producer = shared->make_producer();
+
+                    std::vector<decltype(producer.insert(std::declval<value_type>()))> inserted;
+                    inserted.reserve(PRODUCTIONS);
+
+                    ++ready;
+                    while(!start){
+                        std::this_thread::yield();
+                    }
+
+                    for(std::size_t o = 0; o < PRODUCTIONS; ++o){
+                        inserted.push_back(producer.insert(value_type{o}));
+
+                        if(o % 4 == 3){
+                            erase_produced(producer, inserted[o - 1], std::integral_constant<bool, Erase>());
+                        }
+                    }
+                }));
+            }
+
+            while(ready != static_cast<std::size_t>(thread_count)){
+                std::this_thread::yield();
+            }
+
+            Clock::time_point t0 = Clock::now();
+
+            start = true;
+
+            for(auto& worker : workers){
+                worker.join();
+            }
+
+            Clock::time_point t1 = Clock::now();
+
+            auto us = std::chrono::duration_cast<microseconds>(t1 - t0).count();
+            throughput += (thread_count * PRODUCTIONS * 1000) / (us ? us : 1);
+        }
+
+        graphs::new_result(type, std::to_string(thread_count), throughput / REPEAT);
+    }
+}
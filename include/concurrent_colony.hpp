@@ -0,0 +1,438 @@
+//=======================================================================
+// Copyright (c) 2014 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#ifndef ARTICLES_CONCURRENT_COLONY
+#define ARTICLES_CONCURRENT_COLONY
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+/*!
+ * \brief Colony that can be filled concurrently by several threads.
+ *
+ * Each thread inserts through a producer, which owns a shard of the
+ * container: a list of groups of elements, like the groups of plf::colony,
+ * only filled by this thread. The owner constructs the element at the end of
+ * its last group and then publishes the new number of elements of the group,
+ * the iterations only read the elements below this published count. The
+ * insertions take no lock, only a new group goes through the allocator. The
+ * elements never move, so the pointers to the elements stay valid until they
+ * are erased.
+ *
+ * An erased element is marked with a tombstone and retired: the iterations
+ * starting after the erasure skip it, and it is destroyed later by the
+ * reclamation of its shard, once the iterations that were running at the
+ * erasure have ended (epoch-based reclamation). A group whose elements are
+ * all destroyed is unlinked and deallocated the same way. A thread iterating
+ * over the container can therefore keep pointers to the elements it visits
+ * until the end of its iteration.
+ *
+ * The lock of a shard is only taken by the reclamation, which the owner of
+ * the shard and concurrent_colony::reclaim() can run.
+ */
+template<typename T, std::size_t MaxThreads = 64>
+class concurrent_colony {
+    static constexpr std::size_t idle = std::numeric_limits<std::size_t>::max();
+
+    static constexpr std::size_t min_group = 8;
+    static constexpr std::size_t max_group = 8192;
+
+    enum : unsigned char {
+        live,
+        erased,
+        destroyed
+    };
+
+    // An element and its state: the tombstone is set when it is erased, the
+    // state only becomes destroyed under the lock of the shard
+    struct slot {
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+        std::atomic<unsigned char> state{live};
+
+        T& value(){
+            return *reinterpret_cast<T*>(&storage);
+        }
+    };
+
+    // The elements below count are constructed. The next group is only set
+    // once the group is full.
+    struct group {
+        std::unique_ptr<slot[]> slots;
+        std::size_t capacity;
+        std::atomic<std::size_t> count{0};
+        std::atomic<group*> next{nullptr};
+
+        // Number of destroyed elements, only used under the lock of the shard
+        std::size_t dead = 0;
+
+        group(std::size_t capacity) : slots(new slot[capacity]), capacity(capacity) {}
+    };
+
+    // An erased element, waiting for the end of the iterations that may see it
+    struct retired_node {
+        slot* element;
+        group* block;
+        std::size_t epoch;
+        retired_node* next;
+    };
+
+    // An unlinked group, waiting for the end of the iterations that may be in it
+    struct retired_group {
+        group* block;
+        std::size_t epoch;
+    };
+
+    struct shard {
+        std::atomic<group*> head{nullptr};
+
+        // The group being filled, only used by the owner
+        group* tail = nullptr;
+
+        // Only written by the owner and by the reclamation
+        std::atomic<std::size_t> inserted{0};
+        std::atomic<std::size_t> dead{0};
+
+        // Taken by the reclamation only
+        std::mutex lock;
+
+        // Elements erased by any thread, pushed without lock
+        std::atomic<retired_node*> retired{nullptr};
+
+        // Retired elements and unlinked groups not yet safe to destroy, only
+        // used under the lock
+        std::vector<retired_node*> pending;
+        std::vector<retired_group> groups;
+
+        // Set when pending or groups is not empty
+        std::atomic<bool> waiting{false};
+
+        std::atomic<bool> owned{false};
+
+        // Epoch at the start of the current iteration of the owner
+        std::atomic<std::size_t> announced{idle};
+
+        // Avoid false sharing between the shards
+        char padding[64];
+    };
+
+public:
+    using value_type = T;
+
+    //! Reference to an element, with the group and the shard that own it
+    struct handle {
+        slot* element;
+        group* block;
+        std::size_t shard;
+
+        T& operator*() const { return element->value(); }
+        T* operator->() const { return &element->value(); }
+    };
+
+    /*!
+     * \brief Access of one thread to the container.
+     *
+     * A producer must only be used by one thread at a time.
+     */
+    class producer {
+    public:
+        producer(concurrent_colony& parent, std::size_t index) : parent(&parent), index(index), own(&parent.shards[index]) {}
+
+        producer(const producer&) = delete;
+        producer& operator=(const producer&) = delete;
+
+        producer(producer&& rhs) : parent(rhs.parent), index(rhs.index), own(rhs.own), inserted(rhs.inserted) {
+            rhs.own = nullptr;
+        }
+
+        ~producer(){
+            if(own){
+                reclaim();
+                own->owned = false;
+            }
+        }
+
+        handle insert(const T& value){
+            // The reclamation needs to look at all the shards, it is amortized.
+            // It is skipped when concurrent_colony::reclaim() holds the lock.
+            if(!(++inserted % reclaim_period) && (own->retired.load(std::memory_order_relaxed) || own->waiting.load(std::memory_order_relaxed))){
+                std::unique_lock<std::mutex> lock(own->lock, std::try_to_lock);
+
+                if(lock){
+                    parent->reclaim_shard(*own);
+                }
+            }
+
+            auto last = own->tail;
+            auto count = last ? last->count.load(std::memory_order_relaxed) : 0;
+
+            if(!last || count == last->capacity){
+                auto next = new group(last ? std::min(2 * last->capacity, max_group) : min_group);
+
+                if(last){
+                    last->next.store(next, std::memory_order_release);
+                } else {
+                    own->head.store(next, std::memory_order_release);
+                }
+
+                own->tail = last = next;
+                count = 0;
+            }
+
+            auto& element = last->slots[count];
+            new (&element.storage) T(value);
+
+            // From now on, the new iterations see the element
+            last->count.store(count + 1, std::memory_order_release);
+
+            own->inserted.store(own->inserted.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+            return {&element, last, index};
+        }
+
+        /*!
+         * \brief Retire the element, it will be destroyed by the reclamation
+         * of its shard. An element that is already retired is not erased
+         * again and false is returned. The handle must not be used once the
+         * element may have been destroyed.
+         */
+        bool erase(handle element){
+            // From now on, the new iterations do not see the element
+            unsigned char expected = live;
+            if(!element.element->state.compare_exchange_strong(expected, erased)){
+                return false;
+            }
+
+            auto& target = parent->shards[element.shard];
+
+            auto retired = new retired_node{element.element, element.block, parent->epoch.fetch_add(1), target.retired.load(std::memory_order_relaxed)};
+
+            while(!target.retired.compare_exchange_weak(retired->next, retired)){}
+
+            return true;
+        }
+
+        /*!
+         * \brief Call f on all the elements not erased before the start of
+         * the iteration, the ones erased or inserted during the iteration may
+         * be skipped. The elements visited are not destroyed before the end
+         * of the iteration. No lock is taken.
+         */
+        template<typename Functor>
+        void for_each(Functor f){
+            own->announced = parent->epoch.load();
+
+            // A reclamation that missed the announcement only destroys the
+            // elements and the groups unlinked before the fence, the loads
+            // below see their tombstones and the unlinking
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            for(auto& shard : parent->shards){
+                for(auto block = shard.head.load(std::memory_order_acquire); block; block = block->next.load(std::memory_order_acquire)){
+                    auto count = block->count.load(std::memory_order_acquire);
+
+                    for(std::size_t i = 0; i < count; ++i){
+                        auto& element = block->slots[i];
+
+                        if(element.state.load(std::memory_order_acquire) == live){
+                            f(element.value());
+                        }
+                    }
+                }
+            }
+
+            own->announced = idle;
+        }
+
+        //! Destroy the retired elements of the shard that no iteration can see anymore
+        void reclaim(){
+            std::lock_guard<std::mutex> lock(own->lock);
+            parent->reclaim_shard(*own);
+        }
+
+    private:
+        static constexpr std::size_t reclaim_period = 64;
+
+        concurrent_colony* parent;
+        std::size_t index;
+        shard* own;
+        std::size_t inserted = 0;
+    };
+
+    concurrent_colony() = default;
+
+    concurrent_colony(const concurrent_colony&) = delete;
+    concurrent_colony& operator=(const concurrent_colony&) = delete;
+
+    ~concurrent_colony(){
+        for(auto& shard : shards){
+            auto head = shard.retired.load();
+
+            while(head){
+                auto next = head->next;
+                delete head;
+                head = next;
+            }
+
+            for(auto retired : shard.pending){
+                delete retired;
+            }
+
+            for(auto& retired : shard.groups){
+                delete retired.block;
+            }
+
+            auto block = shard.head.load();
+
+            while(block){
+                auto count = block->count.load();
+
+                for(std::size_t i = 0; i < count; ++i){
+                    if(block->slots[i].state.load() != destroyed){
+                        block->slots[i].value().~T();
+                    }
+                }
+
+                auto next = block->next.load();
+                delete block;
+                block = next;
+            }
+        }
+    }
+
+    //! Claim a free shard for the calling thread
+    producer make_producer(){
+        for(std::size_t i = 0; i < MaxThreads; ++i){
+            if(!shards[i].owned.exchange(true)){
+                return producer(*this, i);
+            }
+        }
+
+        throw std::runtime_error("concurrent_colony: too many producers");
+    }
+
+    //! Destroy the retired elements of all the shards, including the shards without producer
+    void reclaim(){
+        for(auto& shard : shards){
+            std::lock_guard<std::mutex> lock(shard.lock);
+            reclaim_shard(shard);
+        }
+    }
+
+    //! Number of elements, including the ones retired but not yet destroyed
+    std::size_t size() const {
+        std::size_t count = 0;
+
+        for(auto& shard : shards){
+            count += shard.inserted.load(std::memory_order_relaxed) - shard.dead.load(std::memory_order_relaxed);
+        }
+
+        return count;
+    }
+
+private:
+    std::array<shard, MaxThreads> shards;
+    std::atomic<std::size_t> epoch{0};
+
+    // The retired elements with an older epoch cannot be seen by any iteration
+    std::size_t safe_epoch() const {
+        auto safe = epoch.load();
+
+        for(auto& shard : shards){
+            auto announced = shard.announced.load();
+
+            if(announced < safe){
+                safe = announced;
+            }
+        }
+
+        return safe;
+    }
+
+    // Must be called with the lock of the shard
+    void reclaim_shard(shard& target){
+        auto head = target.retired.exchange(nullptr);
+
+        while(head){
+            target.pending.push_back(head);
+            head = head->next;
+        }
+
+        auto safe = safe_epoch();
+
+        auto kept_group = target.groups.begin();
+
+        for(auto& retired : target.groups){
+            if(retired.epoch < safe){
+                delete retired.block;
+            } else {
+                *kept_group++ = retired;
+            }
+        }
+
+        target.groups.erase(kept_group, target.groups.end());
+
+        auto kept = target.pending.begin();
+
+        for(auto retired : target.pending){
+            if(retired->epoch < safe){
+                retired->element->value().~T();
+                retired->element->state.store(destroyed, std::memory_order_relaxed);
+
+                ++retired->block->dead;
+                target.dead.store(target.dead.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+                delete retired;
+            } else {
+                *kept++ = retired;
+            }
+        }
+
+        target.pending.erase(kept, target.pending.end());
+
+        // Unlink the empty groups, except the last one that the owner may
+        // still fill. The owner never writes the links before the last group.
+        auto previous = &target.head;
+
+        for(auto block = previous->load(); block; ){
+            auto next = block->next.load();
+
+            if(next && block->dead == block->capacity){
+                previous->store(next);
+                target.groups.push_back({block, epoch.fetch_add(1)});
+            } else {
+                previous = &block->next;
+            }
+
+            block = next;
+        }
+
+        target.waiting.store(!target.pending.empty() || !target.groups.empty(), std::memory_order_relaxed);
+    }
+};
+
+template<typename T, std::size_t MaxThreads>
+constexpr std::size_t concurrent_colony<T, MaxThreads>::idle;
+
+template<typename T, std::size_t MaxThreads>
+constexpr std::size_t concurrent_colony<T, MaxThreads>::min_group;
+
+template<typename T, std::size_t MaxThreads>
+constexpr std::size_t concurrent_colony<T, MaxThreads>::max_group;
+
+template<typename T, std::size_t MaxThreads>
+constexpr std::size_t concurrent_colony<T, MaxThreads>::producer::reclaim_period;
+
+#endif
@@ -0,0 +1,246 @@
+//=======================================================================
+// Copyright (c) 2015 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#ifndef ARTICLES_CONFIGURABLE
+#define ARTICLES_CONFIGURABLE
+
+#include <type_traits>
+
+/*
+ * Named template parameters. Each parameter has a type_id, the lookups search
+ * Args... for the parameter with the same type_id as the default parameter D
+ * and fall back to D when it is not present.
+ */
+
+template<typename ID, typename T, T value>
+struct value_conf_t : std::integral_constant<T, value> {
+    using type_id = ID;
+};
+
+template<typename ID>
+struct basic_conf_t {
+    using type_id = ID;
+};
+
+template<typename ID, typename T>
+struct type_conf_t {
+    using type_id = ID;
+    using value = T;
+};
+
+template<typename ID, template<typename> class T>
+struct template_type_conf_t {
+    using type_id = ID;
+    
+    template<typename C>
+    using value = T<C>;
+};
+
+/*
+ * The lookups walk Args... recursively, with one nested impl per argument.
+ * Looking up all the parameters instantiates O(n^2) types, they are kept to
+ * compare with the lookups below.
+ */
+namespace recursive_lookup {
+
+template<typename D, typename... Args>
+struct get_value_int;
+
+template<typename D>
+struct get_value_int<D> : std::integral_constant<int, D::value> {};
+
+template<typename D, typename T2, typename... Args>
+struct get_value_int<D, T2, Args...> {
+    template<typename D2, typename T22, typename Enable = void>
+    struct impl 
+        : std::integral_constant<int, get_value_int<D, Args...>::value> {};
+
+    template<typename D2, typename T22>
+    struct impl <D2, T22, typename std::enable_if<std::is_same<typename D2::type_id, typename T22::type_id>::value>::type> 
+        : std::integral_constant<int, T22::value> {};
+
+    static constexpr const int value = impl<D, T2>::value;
+};
+
+
+template<typename D, typename... Args>
+struct get_value;
+
+template<typename D, typename T2, typename... Args>
+struct get_value<D, T2, Args...> {
+    template<typename D2, typename T22, typename Enable = void>
+    struct impl 
+        : std::integral_constant<decltype(D::value), get_value<D, Args...>::value> {};
+
+    template<typename D2, typename T22>
+    struct impl <D2, T22, typename std::enable_if<std::is_same<typename D2::type_id, typename T22::type_id>::value>::type> 
+        : std::integral_constant<decltype(D::value), T22::value> {};
+
+    static constexpr const auto value = impl<D, T2>::value;
+};
+
+template<typename D>
+struct get_value<D> : std::integral_constant<decltype(D::value), D::value> {};
+
+
+template<typename D, typename... Args>
+struct get_type;
+
+template<typename D, typename T2, typename... Args>
+struct get_type<D, T2, Args...> {
+    template<typename D2, typename T22, typename Enable = void>
+    struct impl {
+        using value = typename get_type<D, Args...>::value;
+    };
+
+    template<typename D2, typename T22>
+    struct impl <D2, T22, typename std::enable_if<std::is_same<typename D2::type_id, typename T22::type_id>::value>::type> {
+        using value = typename T22::value;
+    };
+
+    using value = typename impl<D, T2>::value;
+};
+
+template<typename D>
+struct get_type<D> {
+    using value = typename D::value;
+};
+
+
+template<typename D, typename... Args>
+struct get_template_type;
+
+template<typename D, typename T2, typename... Args>
+struct get_template_type<D, T2, Args...> {
+    template<typename D2, typename T22, typename Enable = void>
+    struct impl {
+        template<typename C>
+        using value = typename get_template_type<D, Args...>::template value<C>;
+    };
+
+    template<typename D2, typename T22>
+    struct impl <D2, T22, typename std::enable_if<std::is_same<typename D2::type_id, typename T22::type_id>::value>::type> {
+        template<typename C>
+        using value = typename T22::template value<C>;
+    };
+
+    template<typename C>
+    using value = typename impl<D, T2>::template value<C>;
+};
+
+template<typename D>
+struct get_template_type<D> {
+    template<typename C>
+    using value = typename D::template value<C>;
+};
+
+
+
+template<typename T1, typename... Args>
+struct is_present;
+
+template<typename T1, typename T2, typename... Args>
+struct is_present<T1, T2, Args...> : std::integral_constant<bool, std::is_same<T1, T2>::value || is_present<T1, Args...>::value> {};
+
+template<typename T1>
+struct is_present<T1> : std::false_type {};
+
+
+template<typename... Valid>
+struct tmp_list {
+    template<typename T>
+    struct contains : std::integral_constant<bool, is_present<typename T::type_id, Valid...>::value> {};
+};
+
+template<typename L, typename... Args>
+struct is_valid;
+
+template<typename L, typename T1, typename... Args>
+struct is_valid <L, T1, Args...> : std::integral_constant<bool, L::template contains<T1>::value && is_valid<L, Args...>::value> {};
+
+template<typename L>
+struct is_valid <L> : std::true_type {};
+
+} //end of namespace recursive_lookup
+
+namespace conf_detail {
+
+template<typename T>
+struct box {
+    using type = T;
+};
+
+template<typename ID>
+struct id_tag {};
+
+template<typename ID, typename T>
+struct node {};
+
+/*
+ * All the parameters as bases of the same type, the lookups are a single
+ * derived to base conversion. The id_tag bases make two parameters with the
+ * same type_id a compile error instead of an ambiguous lookup.
+ */
+template<typename... Args>
+struct map : id_tag<typename Args::type_id>..., node<typename Args::type_id, Args>... {};
+
+template<typename ID, typename T>
+box<T> find(const node<ID, T>*);
+
+template<typename D, typename Map>
+auto lookup(int) -> decltype(find<typename D::type_id>(static_cast<const Map*>(nullptr)));
+
+template<typename D, typename Map>
+box<D> lookup(...);
+
+//! The parameter with the same type_id as D in Args..., D if there is none
+template<typename D, typename... Args>
+using lookup_t = typename decltype(lookup<D, map<Args...>>(0))::type;
+
+template<bool... B>
+struct bool_pack {};
+
+//! True if all the values are true, without recursion
+template<bool... B>
+using all_of = std::is_same<bool_pack<true, B...>, bool_pack<B..., true>>;
+
+} //end of namespace conf_detail
+
+/*
+ * The lookups used by configurable_v2, their instantiation depth does not
+ * depend on the number of parameters.
+ */
+
+template<typename D, typename... Args>
+struct get_value : std::integral_constant<decltype(D::value), conf_detail::lookup_t<D, Args...>::value> {};
+
+template<typename D, typename... Args>
+struct get_type {
+    using value = typename conf_detail::lookup_t<D, Args...>::value;
+};
+
+template<typename D, typename... Args>
+struct get_template_type {
+    template<typename C>
+    using value = typename conf_detail::lookup_t<D, Args...>::template value<C>;
+};
+
+template<typename T1, typename... Args>
+struct is_present : std::integral_constant<bool, !conf_detail::all_of<!std::is_same<T1, Args>::value...>::value> {};
+
+template<typename... Valid>
+struct tmp_list {
+    struct ids : conf_detail::id_tag<Valid>... {};
+
+    template<typename T>
+    struct contains : std::is_base_of<conf_detail::id_tag<typename T::type_id>, ids> {};
+};
+
+template<typename L, typename... Args>
+struct is_valid : conf_detail::all_of<L::template contains<Args>::value...> {};
+
+#endif
@@ -0,0 +1,345 @@
+//=======================================================================
+// Copyright (c) 2014 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#ifndef ARTICLES_CT_MATH
+#define ARTICLES_CT_MATH
+
+#include <cstdint>
+#include <type_traits>
+
+/*
+ * Integer math usable in constant expressions.
+ *
+ * The recursion depth of all the functions is logarithmic in their
+ * arguments, so they work for all the 64 bits values without raising the
+ * constexpr or template depth limits. With C++14, the functions are written
+ * with loops instead, only the primality test still recurses.
+ */
+
+#if defined(__cpp_constexpr) && __cpp_constexpr >= 201304
+#define ARTICLES_CT_MATH_LOOPS
+#endif
+
+namespace ct_math {
+
+using value_t = std::uint64_t;
+
+namespace detail {
+
+// Largest x in [l, r] with x^2 <= n, knowing that l is one
+constexpr value_t isqrt(value_t n, value_t l, value_t r){
+    return l == r ? l
+        : (l + (r - l + 1) / 2) <= n / (l + (r - l + 1) / 2) ? isqrt(n, l + (r - l + 1) / 2, r)
+        : isqrt(n, l, l + (r - l + 1) / 2 - 1);
+}
+
+// Largest x in [l, r] with x^3 <= n, knowing that l is one
+constexpr value_t icbrt(value_t n, value_t l, value_t r){
+    return l == r ? l
+        : (l + (r - l + 1) / 2) <= n / (l + (r - l + 1) / 2) / (l + (r - l + 1) / 2) ? icbrt(n, l + (r - l + 1) / 2, r)
+        : icbrt(n, l, l + (r - l + 1) / 2 - 1);
+}
+
+// Position of the highest set bit, looking at shifts of s, s/2, ..., 1
+constexpr value_t ilog2(value_t n, value_t s){
+    return s == 0 ? 0 : (n >> s) ? s + ilog2(n >> s, s / 2) : ilog2(n, s / 2);
+}
+
+constexpr value_t ipow(value_t base, value_t exp, value_t result){
+    return exp == 0 ? result : ipow(base * base, exp / 2, exp % 2 ? result * base : result);
+}
+
+#ifdef __SIZEOF_INT128__
+
+// (a * b) % m without overflow
+constexpr value_t mulmod(value_t a, value_t b, value_t m){
+    return static_cast<value_t>(static_cast<unsigned __int128>(a) * b % m);
+}
+
+#else
+
+// (x + y) % m without overflow, for x and y lower than m
+constexpr value_t addmod(value_t x, value_t y, value_t m){
+    return x >= m - y ? x - (m - y) : x + y;
+}
+
+constexpr value_t mulmod(value_t a, value_t b, value_t m);
+
+// (a * b) % m from half = (a * (b / 2)) % m
+constexpr value_t mulmod_step(value_t half, value_t a, value_t b, value_t m){
+    return addmod(addmod(half, half, m), b % 2 ? a % m : 0, m);
+}
+
+// (a * b) % m without overflow
+constexpr value_t mulmod(value_t a, value_t b, value_t m){
+    return b == 0 ? 0 : mulmod_step(mulmod(a, b / 2, m), a, b, m);
+}
+
+#endif
+
+constexpr value_t powmod(value_t base, value_t exp, value_t m){
+    return exp == 0 ? 1 % m
+        : exp % 2 ? mulmod(base % m, powmod(mulmod(base, base, m), exp / 2, m), m)
+        : powmod(mulmod(base, base, m), exp / 2, m);
+}
+
+// Number of trailing zeros of an even n - 1
+constexpr value_t trailing_zeros(value_t d){
+    return d % 2 ? 0 : 1 + trailing_zeros(d / 2);
+}
+
+constexpr value_t odd_part(value_t d){
+    return d % 2 ? d : odd_part(d / 2);
+}
+
+// Square x until it reaches n - 1, at most s - 1 times
+constexpr bool witness_squares(value_t x, value_t n, value_t s){
+    return s == 0 ? false : x == n - 1 ? true : witness_squares(mulmod(x, x, n), n, s - 1);
+}
+
+// True if n passes the Miller-Rabin test for the base a
+constexpr bool strong_probable_prime(value_t n, value_t a){
+    return a % n == 0
+        || powmod(a, odd_part(n - 1), n) == 1
+        || witness_squares(powmod(a, odd_part(n - 1), n), n, trailing_zeros(n - 1));
+}
+
+// The first twelve primes are enough bases for all the 64 bits values
+constexpr bool miller_rabin(value_t n){
+    return strong_probable_prime(n, 2) && strong_probable_prime(n, 3) && strong_probable_prime(n, 5)
+        && strong_probable_prime(n, 7) && strong_probable_prime(n, 11) && strong_probable_prime(n, 13)
+        && strong_probable_prime(n, 17) && strong_probable_prime(n, 19) && strong_probable_prime(n, 23)
+        && strong_probable_prime(n, 29) && strong_probable_prime(n, 31) && strong_probable_prime(n, 37);
+}
+
+constexpr bool is_prime(value_t n){
+    return n < 2 ? false : n < 4 ? true : n % 2 == 0 ? false : miller_rabin(n);
+}
+
+#ifndef ARTICLES_CT_MATH_LOOPS
+
+constexpr value_t first_prime(value_t l, value_t r);
+
+// The first prime of the left half if found, otherwise of the right half
+constexpr value_t first_prime_step(value_t left, value_t mid, value_t r){
+    return left != mid ? left : first_prime(mid, r);
+}
+
+// First prime in [l, r[ or r if there is none, by bisection of the range
+constexpr value_t first_prime(value_t l, value_t r){
+    return r - l == 1 ? (is_prime(l) ? l : r) : first_prime_step(first_prime(l, l + (r - l) / 2), l + (r - l) / 2, r);
+}
+
+constexpr value_t next_prime(value_t n, value_t window);
+
+constexpr value_t next_prime_step(value_t found, value_t n, value_t window){
+    return found != n + window ? found : next_prime(n + window, window * 2);
+}
+
+// Search in windows of doubling sizes
+constexpr value_t next_prime(value_t n, value_t window){
+    return next_prime_step(first_prime(n, n + window), n, window);
+}
+
+#endif
+
+} //end of namespace detail
+
+#ifdef ARTICLES_CT_MATH_LOOPS
+
+//! Largest x with x^2 <= n
+constexpr value_t isqrt(value_t n){
+    value_t l = 0;
+    value_t r = n < (value_t(1) << 32) - 1 ? n : (value_t(1) << 32) - 1;
+
+    while(l < r){
+        value_t mid = l + (r - l + 1) / 2;
+
+        if(mid <= n / mid){
+            l = mid;
+        } else {
+            r = mid - 1;
+        }
+    }
+
+    return l;
+}
+
+//! Largest x with x^3 <= n
+constexpr value_t icbrt(value_t n){
+    value_t l = 0;
+    value_t r = n < (value_t(1) << 22) - 1 ? n : (value_t(1) << 22) - 1;
+
+    while(l < r){
+        value_t mid = l + (r - l + 1) / 2;
+
+        if(mid <= n / mid / mid){
+            l = mid;
+        } else {
+            r = mid - 1;
+        }
+    }
+
+    return l;
+}
+
+//! Position of the highest set bit of n, 0 for 0
+constexpr value_t ilog2(value_t n){
+    value_t result = 0;
+
+    for(value_t s = 32; s; s /= 2){
+        if(n >> s){
+            n >>= s;
+            result += s;
+        }
+    }
+
+    return result;
+}
+
+//! base^exp, modulo 2^64
+constexpr value_t ipow(value_t base, value_t exp){
+    value_t result = 1;
+
+    while(exp){
+        if(exp % 2){
+            result *= base;
+        }
+
+        base *= base;
+        exp /= 2;
+    }
+
+    return result;
+}
+
+constexpr value_t gcd(value_t a, value_t b){
+    while(b){
+        value_t r = a % b;
+        a = b;
+        b = r;
+    }
+
+    return a;
+}
+
+//! Smallest prime >= n
+constexpr value_t next_prime(value_t n){
+    while(!detail::is_prime(n)){
+        ++n;
+    }
+
+    return n;
+}
+
+#else
+
+//! Largest x with x^2 <= n
+constexpr value_t isqrt(value_t n){
+    return n < 2 ? n : detail::isqrt(n, 1, n < (value_t(1) << 32) - 1 ? n : (value_t(1) << 32) - 1);
+}
+
+//! Largest x with x^3 <= n
+constexpr value_t icbrt(value_t n){
+    return n < 2 ? n : detail::icbrt(n, 1, n < (value_t(1) << 22) - 1 ? n : (value_t(1) << 22) - 1);
+}
+
+//! Position of the highest set bit of n, 0 for 0
+constexpr value_t ilog2(value_t n){
+    return detail::ilog2(n, 32);
+}
+
+//! base^exp, modulo 2^64
+constexpr value_t ipow(value_t base, value_t exp){
+    return detail::ipow(base, exp, 1);
+}
+
+constexpr value_t gcd(value_t a, value_t b){
+    return b == 0 ? a : gcd(b, a % b);
+}
+
+//! Smallest prime >= n
+constexpr value_t next_prime(value_t n){
+    return detail::is_prime(n) ? n : detail::next_prime(n, 16);
+}
+
+#endif
+
+constexpr bool is_prime(value_t n){
+    return detail::is_prime(n);
+}
+
+/*
+ * The same functions as pure template metaprograms, the result is the value
+ * member. next_prime has no template version, the Miller-Rabin test would
+ * instantiate thousands of types.
+ */
+namespace tmp {
+
+namespace detail {
+
+template<value_t N, value_t L, value_t R, value_t Mid = L + (R - L + 1) / 2, bool Lower = (Mid <= N / Mid)>
+struct isqrt : isqrt<N, Lower ? Mid : L, Lower ? R : Mid - 1> {};
+
+template<value_t N, value_t L, value_t Mid, bool Lower>
+struct isqrt<N, L, L, Mid, Lower> : std::integral_constant<value_t, L> {};
+
+template<value_t N, value_t L, value_t R, value_t Mid = L + (R - L + 1) / 2, bool Lower = (Mid <= N / Mid / Mid)>
+struct icbrt : icbrt<N, Lower ? Mid : L, Lower ? R : Mid - 1> {};
+
+template<value_t N, value_t L, value_t Mid, bool Lower>
+struct icbrt<N, L, L, Mid, Lower> : std::integral_constant<value_t, L> {};
+
+template<value_t N, value_t S, bool Higher = (N >> S) != 0>
+struct ilog2 : std::integral_constant<value_t, S + ilog2<(N >> S), S / 2>::value> {};
+
+template<value_t N, value_t S>
+struct ilog2<N, S, false> : ilog2<N, S / 2> {};
+
+template<value_t N, bool Higher>
+struct ilog2<N, 0, Higher> : std::integral_constant<value_t, 0> {};
+
+template<value_t Base, value_t Exp, value_t Result>
+struct ipow : ipow<Base * Base, Exp / 2, Exp % 2 ? Result * Base : Result> {};
+
+template<value_t Base, value_t Result>
+struct ipow<Base, 0, Result> : std::integral_constant<value_t, Result> {};
+
+} //end of namespace detail
+
+template<value_t N>
+struct isqrt : detail::isqrt<N, 1, (N < (value_t(1) << 32) - 1 ? N : (value_t(1) << 32) - 1)> {};
+
+template<>
+struct isqrt<0> : std::integral_constant<value_t, 0> {};
+
+template<value_t N>
+struct icbrt : detail::icbrt<N, 1, (N < (value_t(1) << 22) - 1 ? N : (value_t(1) << 22) - 1)> {};
+
+template<>
+struct icbrt<0> : std::integral_constant<value_t, 0> {};
+
+template<value_t N>
+struct ilog2 : detail::ilog2<N, 32> {};
+
+template<>
+struct ilog2<0> : std::integral_constant<value_t, 0> {};
+
+template<value_t Base, value_t Exp>
+struct ipow : detail::ipow<Base, Exp, 1> {};
+
+template<value_t A, value_t B>
+struct gcd : gcd<B, A % B> {};
+
+template<value_t A>
+struct gcd<A, 0> : std::integral_constant<value_t, A> {};
+
+} //end of namespace tmp
+
+} //end of namespace ct_math
+
+#endif
@@ -0,0 +1,221 @@
+//=======================================================================
+// Copyright (c) 2014 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#ifndef ARTICLES_FLAT_BTREE
+#define ARTICLES_FLAT_BTREE
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+/*!
+ * \brief Sorted container stored as a two-level B+tree.
+ *
+ * The elements are kept in small sorted contiguous leaves of about LeafBytes
+ * bytes. The root is a contiguous array of leaves, searched by binary search
+ * on the last element of each leaf. Positioning is logarithmic, insertion
+ * only shifts the elements of one leaf and iteration scans the leaves in
+ * order.
+ */
+template<typename T, std::size_t LeafBytes = 4096, typename Compare = std::less<T>>
+class flat_btree {
+public:
+    static constexpr std::size_t leaf_capacity = LeafBytes / sizeof(T) > 8 ? LeafBytes / sizeof(T) : 8;
+
+    using value_type      = T;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference       = T&;
+    using const_reference = const T&;
+
+private:
+    using leaf_type = std::vector<T>;
+    using leaves_type = std::vector<leaf_type>;
+
+    template<typename Leaves, typename Value>
+    class iterator_impl {
+        Leaves* leaves = nullptr;
+        std::size_t l = 0;
+        std::size_t i = 0;
+
+        iterator_impl(Leaves* leaves, std::size_t l, std::size_t i) : leaves(leaves), l(l), i(i) {}
+
+        friend class flat_btree;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = T;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = Value*;
+        using reference         = Value&;
+
+        iterator_impl() = default;
+
+        reference operator*() const {
+            return (*leaves)[l][i];
+        }
+
+        pointer operator->() const {
+            return &(*leaves)[l][i];
+        }
+
+        iterator_impl& operator++(){
+            if(++i == (*leaves)[l].size()){
+                ++l;
+                i = 0;
+            }
+
+            return *this;
+        }
+
+        iterator_impl operator++(int){
+            iterator_impl copy(*this);
+            ++*this;
+            return copy;
+        }
+
+        friend bool operator==(const iterator_impl& lhs, const iterator_impl& rhs){
+            return lhs.l == rhs.l && lhs.i == rhs.i;
+        }
+
+        friend bool operator!=(const iterator_impl& lhs, const iterator_impl& rhs){
+            return !(lhs == rhs);
+        }
+    };
+
+public:
+    using iterator       = iterator_impl<const leaves_type, const T>;
+    using const_iterator = iterator;
+
+    flat_btree() = default;
+
+    explicit flat_btree(const Compare& compare) : compare(compare) {}
+
+    iterator begin() const { return {&leaves, 0, 0}; }
+    iterator end() const { return {&leaves, leaves.size(), 0}; }
+
+    size_type size() const {
+        return elements;
+    }
+
+    bool empty() const {
+        return elements == 0;
+    }
+
+    /*!
+     * \brief Return an iterator to the first element not less than value.
+     */
+    iterator lower_bound(const T& value) const {
+        auto l = find_leaf(value);
+
+        if(l == leaves.end()){
+            return end();
+        }
+
+        auto i = std::lower_bound(l->begin(), l->end(), value, compare);
+
+        return {&leaves, static_cast<std::size_t>(l - leaves.begin()), static_cast<std::size_t>(i - l->begin())};
+    }
+
+    /*!
+     * \brief Insert value before the first element not less than it.
+     */
+    iterator insert(const T& value){
+        ++elements;
+
+        if(leaves.empty()){
+            leaves.emplace_back();
+            leaves.back().reserve(leaf_capacity + 1);
+            leaves.back().push_back(value);
+            return begin();
+        }
+
+        auto l = find_leaf(value);
+
+        // Larger than all the elements, append to the last leaf
+        if(l == leaves.end()){
+            --l;
+        }
+
+        auto i = l->insert(std::lower_bound(l->begin(), l->end(), value, compare), value);
+
+        std::size_t leaf_index = l - leaves.begin();
+        std::size_t index = i - l->begin();
+
+        if(l->size() > leaf_capacity){
+            split(leaf_index);
+
+            if(index >= leaves[leaf_index].size()){
+                index -= leaves[leaf_index].size();
+                ++leaf_index;
+            }
+        }
+
+        return {&leaves, leaf_index, index};
+    }
+
+    iterator erase(const_iterator position){
+        auto& leaf = leaves[position.l];
+
+        leaf.erase(leaf.begin() + position.i);
+        --elements;
+
+        if(leaf.empty()){
+            leaves.erase(leaves.begin() + position.l);
+            return {&leaves, position.l, 0};
+        }
+
+        if(position.i == leaf.size()){
+            return {&leaves, position.l + 1, 0};
+        }
+
+        return position;
+    }
+
+    void clear(){
+        leaves.clear();
+        elements = 0;
+    }
+
+private:
+    leaves_type leaves;
+    std::size_t elements = 0;
+    Compare compare;
+
+    // The first leaf whose last element is not less than value
+    typename leaves_type::const_iterator find_leaf(const T& value) const {
+        return std::lower_bound(leaves.begin(), leaves.end(), value,
+            [this](const leaf_type& leaf, const T& v){ return compare(leaf.back(), v); });
+    }
+
+    typename leaves_type::iterator find_leaf(const T& value){
+        return std::lower_bound(leaves.begin(), leaves.end(), value,
+            [this](const leaf_type& leaf, const T& v){ return compare(leaf.back(), v); });
+    }
+
+    // Move the upper half of a full leaf into a new leaf following it
+    void split(std::size_t leaf_index){
+        leaf_type upper;
+        upper.reserve(leaf_capacity + 1);
+
+        auto& leaf = leaves[leaf_index];
+        auto middle = leaf.begin() + leaf.size() / 2;
+
+        std::move(middle, leaf.end(), std::back_inserter(upper));
+        leaf.erase(middle, leaf.end());
+
+        leaves.insert(leaves.begin() + leaf_index + 1, std::move(upper));
+    }
+};
+
+template<typename T, std::size_t LeafBytes, typename Compare>
+constexpr std::size_t flat_btree<T, LeafBytes, Compare>::leaf_capacity;
+
+#endif
@@ -0,0 +1,185 @@
+//=======================================================================
+// Copyright (c) 2014 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#ifndef ARTICLES_INDEXED_LIST
+#define ARTICLES_INDEXED_LIST
+
+#include <cstddef>
+#include <list>
+#include <random>
+#include <utility>
+#include <vector>
+
+/*!
+ * \brief Sorted std::list with a skip list index.
+ *
+ * The std::list is the bottom lane of the skip list, each element being
+ * promoted to the express lanes with a probability of 1/4 per level. The
+ * index is keyed on the a member of the elements, like the policies. The
+ * elements must be inserted at their sorted position.
+ */
+template<typename T>
+class indexed_list {
+public:
+    using list_type       = std::list<T>;
+    using value_type      = T;
+    using size_type       = std::size_t;
+    using iterator        = typename list_type::iterator;
+    using const_iterator  = typename list_type::const_iterator;
+
+    static constexpr std::size_t max_level = 16;
+
+private:
+    struct express {
+        std::size_t key;
+        iterator position;
+        std::vector<express*> next;
+
+        express(std::size_t key, iterator position, std::size_t level) : key(key), position(position), next(level, nullptr) {}
+    };
+
+public:
+    indexed_list() : head(0, iterator(), max_level) {}
+
+    indexed_list(const indexed_list&) = delete;
+    indexed_list& operator=(const indexed_list&) = delete;
+
+    // The list iterators stay valid when the list is moved
+    indexed_list(indexed_list&& rhs) : values(std::move(rhs.values)), head(std::move(rhs.head)), generator(rhs.generator) {
+        rhs.head.next.assign(max_level, nullptr);
+    }
+
+    ~indexed_list(){
+        express* current = head.next[0];
+
+        while(current){
+            express* next = current->next[0];
+            delete current;
+            current = next;
+        }
+    }
+
+    iterator begin(){ return values.begin(); }
+    iterator end(){ return values.end(); }
+
+    const_iterator begin() const { return values.begin(); }
+    const_iterator end() const { return values.end(); }
+
+    size_type size() const {
+        return values.size();
+    }
+
+    bool empty() const {
+        return values.empty();
+    }
+
+    /*!
+     * \brief Return an iterator to the first element whose key is not less
+     * than key.
+     */
+    iterator lower_bound(std::size_t key){
+        express* update[max_level];
+        search(key, update);
+
+        iterator it = update[0] == &head ? values.begin() : update[0]->position;
+
+        while(it != values.end() && it->a < key){
+            ++it;
+        }
+
+        return it;
+    }
+
+    void push_back(const T& value){
+        insert(values.end(), value);
+    }
+
+    /*!
+     * \brief Insert value before position, which must be its sorted position
+     */
+    iterator insert(const_iterator position, const T& value){
+        iterator it = values.insert(position, value);
+
+        std::size_t level = random_level();
+
+        if(level > 0){
+            express* update[max_level];
+            search(value.a, update);
+
+            express* node = new express(value.a, it, level);
+
+            for(std::size_t l = 0; l < level; ++l){
+                node->next[l] = update[l]->next[l];
+                update[l]->next[l] = node;
+            }
+        }
+
+        return it;
+    }
+
+    iterator erase(const_iterator position){
+        std::size_t key = position->a;
+
+        express* update[max_level];
+        search(key, update);
+
+        // Several elements may share the key, find the one at position
+        express* node = update[0]->next[0];
+        while(node && node->key == key && node->position != position){
+            node = node->next[0];
+        }
+
+        if(node && node->key == key){
+            for(std::size_t l = 0; l < node->next.size(); ++l){
+                express* previous = update[l];
+
+                while(previous->next[l] != node){
+                    previous = previous->next[l];
+                }
+
+                previous->next[l] = node->next[l];
+            }
+
+            delete node;
+        }
+
+        return values.erase(position);
+    }
+
+private:
+    list_type values;
+    express head;
+    std::minstd_rand generator;
+
+    std::size_t random_level(){
+        std::size_t level = 0;
+
+        while(level < max_level && (generator() & 3) == 0){
+            ++level;
+        }
+
+        return level;
+    }
+
+    // Find, for each level, the last express node whose key is less than key
+    void search(std::size_t key, express** update){
+        express* current = &head;
+
+        for(std::size_t l = max_level; l-- > 0;){
+            while(current->next[l] && current->next[l]->key < key){
+                current = current->next[l];
+            }
+
+            update[l] = current;
+        }
+    }
+};
+
+template<typename T>
+constexpr std::size_t indexed_list<T>::max_level;
+
+#endif
@@ -0,0 +1,164 @@
+//=======================================================================
+// Copyright (c) 2014 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#ifndef ARTICLES_PARALLEL_SORT
+#define ARTICLES_PARALLEL_SORT
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// The standard parallel algorithms are only available from C++17 and may need
+// to be linked with TBB (libstdc++), so they must be enabled explicitly by
+// defining ARTICLES_USE_EXECUTION
+#if defined(ARTICLES_USE_EXECUTION) && __cplusplus >= 201703L
+#include <execution>
+#define ARTICLES_HAS_EXECUTION
+#endif
+
+namespace parallel_detail {
+
+inline std::size_t default_threads(){
+    std::size_t threads = std::thread::hardware_concurrency();
+    return threads ? threads : 1;
+}
+
+// Three-way partition around the median of three, returns the range of the
+// elements equal to the pivot, which are at their final position
+template<typename Iterator, typename Compare>
+std::pair<Iterator, Iterator> partition(Iterator first, Iterator last, Compare comp){
+    auto middle = first + (last - first) / 2;
+    auto back = last - 1;
+
+    // Median of three
+    auto pivot_it = middle;
+    if(comp(*first, *middle)){
+        if(comp(*middle, *back)){
+            pivot_it = middle;
+        } else if(comp(*first, *back)){
+            pivot_it = back;
+        } else {
+            pivot_it = first;
+        }
+    } else if(comp(*first, *back)){
+        pivot_it = first;
+    } else if(comp(*middle, *back)){
+        pivot_it = back;
+    }
+
+    auto pivot = *pivot_it;
+
+    auto lower = std::partition(first, last, [&](const decltype(pivot)& v){ return comp(v, pivot); });
+    auto upper = std::partition(lower, last, [&](const decltype(pivot)& v){ return !comp(pivot, v); });
+
+    return {lower, upper};
+}
+
+} //end of namespace parallel_detail
+
+/*!
+ * \brief Sort the range with a parallel quicksort.
+ *
+ * The threads share a queue of ranges. Each thread partitions its range,
+ * pushes the larger part in the queue and continues with the smaller one
+ * until it is small enough to be sorted sequentially with std::sort.
+ */
+template<typename Iterator, typename Compare>
+void parallel_sort(Iterator first, Iterator last, Compare comp, std::size_t threads){
+    const std::size_t n = last - first;
+    const std::size_t cutoff = std::max<std::size_t>(n / (threads * 16), 4096);
+
+    if(threads <= 1 || n <= cutoff){
+        std::sort(first, last, comp);
+        return;
+    }
+
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::vector<std::pair<Iterator, Iterator>> tasks{{first, last}};
+
+    // Number of elements not yet at their final position
+    std::size_t remaining = n;
+
+    auto worker = [&](){
+        std::unique_lock<std::mutex> lock(mutex);
+
+        while(true){
+            condition.wait(lock, [&](){ return !tasks.empty() || remaining == 0; });
+
+            if(remaining == 0){
+                return;
+            }
+
+            auto task = tasks.back();
+            tasks.pop_back();
+
+            lock.unlock();
+
+            std::size_t done = 0;
+
+            while(static_cast<std::size_t>(task.second - task.first) > cutoff){
+                auto equal = parallel_detail::partition(task.first, task.second, comp);
+                done += equal.second - equal.first;
+
+                std::pair<Iterator, Iterator> left{task.first, equal.first};
+                std::pair<Iterator, Iterator> right{equal.second, task.second};
+
+                if(left.second - left.first < right.second - right.first){
+                    std::swap(left, right);
+                }
+
+                lock.lock();
+                tasks.push_back(left);
+                lock.unlock();
+                condition.notify_one();
+
+                task = right;
+            }
+
+            std::sort(task.first, task.second, comp);
+            done += task.second - task.first;
+
+            lock.lock();
+
+            remaining -= done;
+
+            if(remaining == 0){
+                condition.notify_all();
+            }
+        }
+    };
+
+    std::vector<std::thread> pool;
+    for(std::size_t t = 1; t < threads; ++t){
+        pool.emplace_back(worker);
+    }
+
+    worker();
+
+    for(auto& thread : pool){
+        thread.join();
+    }
+}
+
+template<typename Iterator, typename Compare>
+void parallel_sort(Iterator first, Iterator last, Compare comp){
+    parallel_sort(first, last, comp, parallel_detail::default_threads());
+}
+
+template<typename Iterator>
+void parallel_sort(Iterator first, Iterator last){
+    parallel_sort(first, last, std::less<typename std::iterator_traits<Iterator>::value_type>());
+}
+
+#endif
@@ -5,8 +5,16 @@
 //  http://opensource.org/licenses/MIT)
 //=======================================================================
 
+#include <set>
+#include <tuple>
+
 #include <boost/intrusive/list.hpp>
 
+#include "barrier.hpp"
+#include "flat_btree.hpp"
+#include "indexed_list.hpp"
+#include "parallel_sort.hpp"
+
 // create policies
 
 //Create empty container
@@ -85,6 +93,41 @@ struct FilledRandom {
 template<class Container>
 std::vector<typename Container::value_type> FilledRandom<Container>::v;
 
+// Same as FilledRandom for std::tuple elements, the first member holds the
+// integer
+
+template<class Container>
+struct FilledRandomTuple {
+    static std::vector<typename Container::value_type> v;
+    inline static Container make(std::size_t size){
+        if(v.size() != size){
+            v.clear();
+            v.reserve(size);
+            for(std::size_t i = 0; i < size; ++i){
+                typename Container::value_type value{};
+                std::get<0>(value) = i;
+                v.push_back(value);
+            }
+            std::shuffle(begin(v), end(v), std::mt19937());
+        }
+
+        Container container;
+        for(std::size_t i = 0; i < size; ++i){
+            container.push_back(v[i]);
+        }
+
+        return container;
+    }
+
+    inline static void clean(){
+        v.clear();
+        v.shrink_to_fit();
+    }
+};
+
+template<class Container>
+std::vector<typename Container::value_type> FilledRandomTuple<Container>::v;
+
 template<class Container>
 struct FilledRandomInsert {
     static std::vector<typename Container::value_type> v;
@@ -117,6 +160,250 @@ struct FilledRandomInsert {
 template<class Container>
 std::vector<typename Container::value_type> FilledRandomInsert<Container>::v;
 
+// Fill with random data and erase every second element, leaving unused
+// capacity (or holes for colony) for the compaction policies
+
+template<class Container>
+struct FilledHalfErased {
+    inline static Container make(std::size_t size){
+        Container container = FilledRandom<Container>::make(size);
+        container.erase(std::remove_if(begin(container), end(container), [](decltype(*begin(container)) v){ return v.a % 2; }), end(container));
+        return container;
+    }
+
+    inline static void clean(){
+        FilledRandom<Container>::clean();
+    }
+};
+
+template<class T>
+struct FilledHalfErased<plf::colony<T>> {
+    inline static plf::colony<T> make(std::size_t size){
+        plf::colony<T> container = FilledRandomInsert<plf::colony<T>>::make(size);
+
+        auto it = container.begin();
+        while(it != container.end()){
+            if(it->a % 2){
+                it = container.erase(it);
+            } else {
+                ++it;
+            }
+        }
+
+        return container;
+    }
+
+    inline static void clean(){
+        FilledRandomInsert<plf::colony<T>>::clean();
+    }
+};
+
+// Fill with random data and erase Percent% of the elements at random
+
+template<std::size_t Percent>
+struct erased {
+    template<class Container>
+    struct Filled {
+        inline static Container make(std::size_t size){
+            Container container = FilledRandom<Container>::make(size);
+
+            std::mt19937 generator;
+            std::uniform_int_distribution<std::size_t> distribution(0, 99);
+
+            container.erase(std::remove_if(begin(container), end(container), [&](decltype(*begin(container))){ return distribution(generator) < Percent; }), end(container));
+
+            return container;
+        }
+
+        inline static void clean(){
+            FilledRandom<Container>::clean();
+        }
+    };
+
+    template<class T>
+    struct Filled<plf::colony<T>> {
+        inline static plf::colony<T> make(std::size_t size){
+            plf::colony<T> container = FilledRandomInsert<plf::colony<T>>::make(size);
+
+            std::mt19937 generator;
+            std::uniform_int_distribution<std::size_t> distribution(0, 99);
+
+            auto it = container.begin();
+            while(it != container.end()){
+                if(distribution(generator) < Percent){
+                    it = container.erase(it);
+                } else {
+                    ++it;
+                }
+            }
+
+            return container;
+        }
+
+        inline static void clean(){
+            FilledRandomInsert<plf::colony<T>>::clean();
+        }
+    };
+};
+
+// Fill with random data and erase the elements with one of the RandomErase
+// policies, before the measure
+
+template<template<class> class Erase>
+struct erased_by {
+    template<class Container>
+    struct Filled {
+        inline static Container make(std::size_t size){
+            Container container = FilledRandom<Container>::make(size);
+            Erase<Container>::run(container, size);
+            return container;
+        }
+
+        inline static void clean(){
+            FilledRandom<Container>::clean();
+        }
+    };
+
+    template<class T>
+    struct Filled<plf::colony<T>> {
+        inline static plf::colony<T> make(std::size_t size){
+            plf::colony<T> container = FilledRandomInsert<plf::colony<T>>::make(size);
+            Erase<plf::colony<T>>::run(container, size);
+            return container;
+        }
+
+        inline static void clean(){
+            FilledRandomInsert<plf::colony<T>>::clean();
+        }
+    };
+};
+
+// Fill with all the integers from the range, in order
+
+template<class Container>
+struct FilledSorted {
+    inline static Container make(std::size_t size){
+        Container container;
+        for(std::size_t i = 0; i < size; ++i){
+            container.push_back({i});
+        }
+
+        return container;
+    }
+
+    inline static void clean(){}
+};
+
+// Fill with all the integers from the range, in order except for one element
+// out of a hundred arriving up to 64 positions late, like the events of a log
+
+template<class Container>
+struct FilledNearlySorted {
+    static std::vector<typename Container::value_type> v;
+
+    inline static void prepare(std::size_t size){
+        if(v.size() != size){
+            v.clear();
+            v.reserve(size);
+            for(std::size_t i = 0; i < size; ++i){
+                v.push_back({i});
+            }
+
+            std::mt19937 generator;
+            std::uniform_int_distribution<std::size_t> late_distribution(0, 99);
+            std::uniform_int_distribution<std::size_t> offset_distribution(1, 64);
+
+            for(std::size_t i = 0; i < size; ++i){
+                if(!late_distribution(generator)){
+                    std::swap(v[i], v[std::min(size - 1, i + offset_distribution(generator))]);
+                }
+            }
+        }
+    }
+
+    inline static Container make(std::size_t size){
+        prepare(size);
+
+        Container container;
+        for(std::size_t i = 0; i < size; ++i){
+            container.push_back(v[i]);
+        }
+
+        return container;
+    }
+
+    inline static void clean(){
+        v.clear();
+        v.shrink_to_fit();
+    }
+};
+
+template<class Container>
+std::vector<typename Container::value_type> FilledNearlySorted<Container>::v;
+
+template<class T>
+struct FilledNearlySorted<plf::colony<T>> {
+    inline static plf::colony<T> make(std::size_t size){
+        FilledNearlySorted<std::vector<T>>::prepare(size);
+
+        plf::colony<T> container;
+        for(auto& value : FilledNearlySorted<std::vector<T>>::v){
+            container.insert(value);
+        }
+
+        return container;
+    }
+
+    inline static void clean(){
+        FilledNearlySorted<std::vector<T>>::clean();
+    }
+};
+
+// Batch of many small containers, the size is the number of elements of each
+// container. The Container is the batch, a std::vector of the containers.
+
+static const std::size_t BATCH = 10000;
+
+template<class Container>
+struct EmptyBatch {
+    inline static Container make(std::size_t) {
+        Container batch;
+        batch.reserve(BATCH);
+        return batch;
+    }
+    inline static void clean(){}
+};
+
+template<class Container>
+struct FilledRandomBatch {
+    // Empty containers receiving the copies, reset outside of the timing
+    static Container copies;
+
+    inline static Container make(std::size_t size){
+        using inner_type = typename Container::value_type;
+
+        Container batch;
+        batch.reserve(BATCH);
+        for(std::size_t i = 0; i < BATCH; ++i){
+            batch.push_back(FilledRandom<inner_type>::make(size));
+        }
+
+        copies.clear();
+        copies.resize(BATCH);
+
+        return batch;
+    }
+
+    inline static void clean(){
+        copies.clear();
+        copies.shrink_to_fit();
+        FilledRandom<typename Container::value_type>::clean();
+    }
+};
+
+template<class Container>
+Container FilledRandomBatch<Container>::copies;
+
 template<class Container>
 struct SmartFilled {
     inline static std::unique_ptr<Container> make(std::size_t size){
@@ -208,6 +495,77 @@ struct FillBackBackup {
     }
 };
 
+template<class T>
+struct FillBackBackup<plf::colony<T>> {
+    inline static void run(plf::colony<T> &c, std::size_t size){
+        for(size_t i=0; i<size; ++i){
+            c.insert(EmptyPrepareBackup<plf::colony<T>>::v[i]);
+        }
+    }
+};
+
+// Bulk fill from the backup with a single range call
+
+template<class Container>
+struct FillBackRange {
+    inline static void run(Container &c, std::size_t size){
+        auto& v = EmptyPrepareBackup<Container>::v;
+        c.insert(std::end(c), v.begin(), v.begin() + size);
+    }
+};
+
+template<class T>
+struct FillBackRange<plf::colony<T>> {
+    inline static void run(plf::colony<T> &c, std::size_t size){
+        auto& v = EmptyPrepareBackup<plf::colony<T>>::v;
+        c.insert(v.begin(), v.begin() + size);
+    }
+};
+
+template<class Container>
+struct AssignRange {
+    inline static void run(Container &c, std::size_t size){
+        auto& v = EmptyPrepareBackup<Container>::v;
+        c.assign(v.begin(), v.begin() + size);
+    }
+};
+
+// Create and fill each container of a batch
+template<class Container>
+struct FillBatch {
+    static const typename Container::value_type::value_type value;
+    inline static void run(Container &c, std::size_t size){
+        for(std::size_t i=0; i<BATCH; ++i){
+            c.emplace_back();
+
+            auto& inner = c.back();
+            for(std::size_t j=0; j<size; ++j){
+                inner.push_back(value);
+            }
+        }
+    }
+};
+
+template<class Container>
+const typename Container::value_type::value_type FillBatch<Container>::value{};
+
+template<class Container>
+struct CopyBatch {
+    inline static void run(Container &c, std::size_t){
+        auto& copies = FilledRandomBatch<Container>::copies;
+        for(std::size_t i=0; i<BATCH; ++i){
+            copies[i] = c[i];
+        }
+    }
+};
+
+template<class Container>
+struct DestroyBatch {
+    inline static void run(Container &c, std::size_t){
+        c.clear();
+    }
+};
+
 template<class Container>
 struct FillBackInserter {
     static const typename Container::value_type value;
@@ -307,6 +665,59 @@ struct Insert {
 template<class Container>
 std::array<typename Container::value_type, 1000> Insert<Container>::values {};
 
+// Insert 1000 elements in the middle of the container, one by one or with a
+// single range insertion. Colony has no positional insertion.
+
+template<class Container>
+struct InsertMiddle {
+    static std::array<typename Container::value_type, 1000> values;
+    inline static void run(Container &c, std::size_t){
+        auto it = std::next(std::begin(c), c.size() / 2);
+        for(std::size_t i=0; i<1000; ++i) {
+            it = c.insert(it, values[i]);
+            ++it;
+        }
+    }
+};
+
+template<class Container>
+std::array<typename Container::value_type, 1000> InsertMiddle<Container>::values {};
+
+template<class T>
+struct InsertMiddle<plf::colony<T>> {
+    static std::array<T, 1000> values;
+    inline static void run(plf::colony<T> &c, std::size_t){
+        for(std::size_t i=0; i<1000; ++i) {
+            c.insert(values[i]);
+        }
+    }
+};
+
+template<class T>
+std::array<T, 1000> InsertMiddle<plf::colony<T>>::values {};
+
+template<class Container>
+struct InsertRangeMiddle {
+    static std::array<typename Container::value_type, 1000> values;
+    inline static void run(Container &c, std::size_t){
+        c.insert(std::next(std::begin(c), c.size() / 2), values.begin(), values.end());
+    }
+};
+
+template<class Container>
+std::array<typename Container::value_type, 1000> InsertRangeMiddle<Container>::values {};
+
+template<class T>
+struct InsertRangeMiddle<plf::colony<T>> {
+    static std::array<T, 1000> values;
+    inline static void run(plf::colony<T> &c, std::size_t){
+        c.insert(values.begin(), values.end());
+    }
+};
+
+template<class T>
+std::array<T, 1000> InsertRangeMiddle<plf::colony<T>>::values {};
+
 template<class Container>
 struct Write {
     inline static void run(Container &c, std::size_t){
@@ -319,6 +730,19 @@ struct Write {
     }
 };
 
+// Same as Write for std::tuple elements
+template<class Container>
+struct WriteTuple {
+    inline static void run(Container &c, std::size_t){
+        auto it = std::begin(c);
+        auto end = std::end(c);
+
+        for(; it != end; ++it){
+            ++std::get<0>(*it);
+        }
+    }
+};
+
 template<class Container>
 struct Iterate {
     inline static void run(Container &c, std::size_t){
@@ -327,10 +751,244 @@ struct Iterate {
 
         while(it != end){
             ++it;
+            do_not_optimize(it);
         }
     }
 };
 
+// Visit the colony by contiguous blocks of elements instead of with the iterator
+
+template<class Container>
+struct BlockFind {
+    static size_t X;
+    inline static void run(Container &c, std::size_t size){
+        for(std::size_t i=0; i<size; ++i) {
+            bool found = false;
+            // The blocks are scanned without early exit so that the loop can be vectorized
+            c.for_each_block([&](typename Container::value_type* first, typename Container::value_type* last){
+                if(found){
+                    return;
+                }
+
+                for(; first != last; ++first){
+                    found |= first->a == i;
+                }
+            });
+
+            if(!found){
+                ++X;
+            }
+        }
+    }
+};
+
+template<class Container>
+size_t BlockFind<Container>::X = 0;
+
+template<class Container>
+struct BlockWrite {
+    inline static void run(Container &c, std::size_t){
+        c.for_each_block([](typename Container::value_type* first, typename Container::value_type* last){
+            for(; first != last; ++first){
+                ++(first->a);
+            }
+        });
+    }
+};
+
+// Every element is read, the sum cannot be computed from the block sizes
+template<class Container>
+struct BlockIterate {
+    inline static void run(Container &c, std::size_t){
+        c.for_each_block([](typename Container::value_type* first, typename Container::value_type* last){
+            for(; first != last; ++first){
+                auto value = first->a;
+                do_not_optimize(value);
+            }
+        });
+    }
+};
+
+// software prefetching
+
+inline void prefetch_address(const void* address){
+#ifdef __GNUC__
+    __builtin_prefetch(address);
+#else
+    (void) address;
+#endif
+}
+
+// Traversal policies prefetching the node Distance steps ahead of the cursor
+
+template<std::size_t Distance>
+struct prefetch {
+    template<class Container>
+    struct Write {
+        inline static void run(Container &c, std::size_t){
+            auto it = std::begin(c);
+            auto ahead = std::begin(c);
+            auto end = std::end(c);
+
+            for(std::size_t i = 0; i < Distance && ahead != end; ++i){
+                ++ahead;
+            }
+
+            for(; ahead != end; ++it, ++ahead){
+                prefetch_address(&*ahead);
+                ++(it->a);
+            }
+
+            for(; it != end; ++it){
+                ++(it->a);
+            }
+        }
+    };
+
+    template<class Container>
+    struct Find {
+        inline static void run(Container &c, std::size_t size){
+            for(std::size_t i=0; i<size; ++i) {
+                auto it = std::begin(c);
+                auto ahead = std::begin(c);
+                auto end = std::end(c);
+
+                for(std::size_t j = 0; j < Distance && ahead != end; ++j){
+                    ++ahead;
+                }
+
+                for(; ahead != end; ++it, ++ahead){
+                    prefetch_address(&*ahead);
+
+                    if(it->a == i){
+                        break;
+                    }
+                }
+
+                if(ahead == end){
+                    while(it != end && it->a != i){
+                        ++it;
+                    }
+                }
+
+                if(it == end){
+                    ++::Find<Container>::X;
+                }
+            }
+        }
+    };
+};
+
+// Traversal policies walking Cursors independent segments of the container in
+// lockstep, so that several pointer chains are in flight at the same time.
+// The segment heads are computed by the create policy, outside of the timing.
+
+template<std::size_t Cursors>
+struct interleaved {
+    template<class Container>
+    struct FilledRandomCursors {
+        static std::vector<typename Container::iterator> cursors;
+        static std::size_t length;
+
+        inline static Container make(std::size_t size){
+            Container container = FilledRandom<Container>::make(size);
+
+            cursors.clear();
+            length = size / Cursors;
+
+            auto it = std::begin(container);
+            for(std::size_t k = 0; k < Cursors; ++k){
+                cursors.push_back(it);
+                std::advance(it, length);
+            }
+
+            return container;
+        }
+
+        inline static void clean(){
+            cursors.clear();
+            cursors.shrink_to_fit();
+            FilledRandom<Container>::clean();
+        }
+    };
+
+    template<class Container>
+    struct Iterate {
+        inline static void run(Container &c, std::size_t){
+            std::array<typename Container::iterator, Cursors> it;
+            std::copy(FilledRandomCursors<Container>::cursors.begin(), FilledRandomCursors<Container>::cursors.end(), it.begin());
+
+            for(std::size_t step = 0; step < FilledRandomCursors<Container>::length; ++step){
+                for(std::size_t k = 0; k < Cursors; ++k){
+                    ++it[k];
+                }
+            }
+
+            auto end = std::end(c);
+            while(it[Cursors - 1] != end){
+                ++it[Cursors - 1];
+            }
+        }
+    };
+
+    template<class Container>
+    struct Write {
+        inline static void run(Container &c, std::size_t){
+            std::array<typename Container::iterator, Cursors> it;
+            std::copy(FilledRandomCursors<Container>::cursors.begin(), FilledRandomCursors<Container>::cursors.end(), it.begin());
+
+            for(std::size_t step = 0; step < FilledRandomCursors<Container>::length; ++step){
+                for(std::size_t k = 0; k < Cursors; ++k){
+                    ++(it[k]->a);
+                    ++it[k];
+                }
+            }
+
+            auto end = std::end(c);
+            for(; it[Cursors - 1] != end; ++it[Cursors - 1]){
+                ++(it[Cursors - 1]->a);
+            }
+        }
+    };
+
+    template<class Container>
+    struct Find {
+        inline static void run(Container &c, std::size_t size){
+            auto end = std::end(c);
+
+            for(std::size_t i=0; i<size; ++i) {
+                std::array<typename Container::iterator, Cursors> it;
+                std::copy(FilledRandomCursors<Container>::cursors.begin(), FilledRandomCursors<Container>::cursors.end(), it.begin());
+
+                bool found = false;
+
+                for(std::size_t step = 0; step < FilledRandomCursors<Container>::length && !found; ++step){
+                    for(std::size_t k = 0; k < Cursors; ++k){
+                        found |= it[k]->a == i;
+                        ++it[k];
+                    }
+                }
+
+                for(; !found && it[Cursors - 1] != end; ++it[Cursors - 1]){
+                    found = it[Cursors - 1]->a == i;
+                }
+
+                if(!found){
+                    ++::Find<Container>::X;
+                }
+            }
+        }
+    };
+};
+
+template<std::size_t Cursors>
+template<class Container>
+std::vector<typename Container::iterator> interleaved<Cursors>::FilledRandomCursors<Container>::cursors;
+
+template<std::size_t Cursors>
+template<class Container>
+std::size_t interleaved<Cursors>::FilledRandomCursors<Container>::length = 0;
+
 template<class Container>
 struct Erase {
     inline static void run(Container &c, std::size_t){
@@ -341,6 +999,36 @@ struct Erase {
     }
 };
 
+// Erase 1000 consecutive elements in the middle of the container, one by one
+// or with a single range erase
+
+template<class Container>
+struct EraseMiddle {
+    inline static void run(Container &c, std::size_t){
+        auto it = std::next(std::begin(c), c.size() / 2);
+        for(std::size_t i=0; i<1000; ++i) {
+            it = c.erase(it);
+        }
+    }
+};
+
+template<class Container>
+struct EraseRange {
+    inline static void run(Container &c, std::size_t){
+        auto first = std::next(std::begin(c), c.size() / 2);
+        c.erase(first, std::next(first, 1000));
+    }
+};
+
+template<class Container>
+struct EraseFront {
+    inline static void run(Container &c, std::size_t){
+        for(std::size_t i=0; i<1000; ++i) {
+            c.erase(std::begin(c));
+        }
+    }
+};
+
 template<class Container>
 struct RemoveErase {
     inline static void run(Container &c, std::size_t){
@@ -386,6 +1074,73 @@ struct TimSort {
     }
 };
 
+template<class T>
+struct TimSort<std::vector<T>> {
+    inline static void run(std::vector<T> &c, std::size_t){
+        plf::timsort(c.begin(), c.end());
+    }
+};
+
+template<class Container>
+struct ParallelTimSort {
+    inline static void run(Container &c, std::size_t){
+        c.par_timsort();
+    }
+};
+
+template<class T>
+struct ParallelTimSort<std::vector<T>> {
+    inline static void run(std::vector<T> &c, std::size_t){
+        plf::parallel_timsort(c.begin(), c.end());
+    }
+};
+
+// Sort the colony on a contiguous buffer of the keys
+
+template<class Container>
+struct KeySort {
+    inline static void run(Container &c, std::size_t){
+        c.key_sort([](const typename Container::value_type& v){ return v.a; });
+    }
+};
+
+// Sort the container with Threads threads (all the cores with 0)
+
+template<std::size_t Threads>
+struct parallel {
+    static std::size_t threads(){
+        return Threads ? Threads : parallel_detail::default_threads();
+    }
+
+    template<class Container>
+    struct Sort {
+        inline static void run(Container &c, std::size_t){
+            parallel_sort(c.begin(), c.end(), std::less<typename Container::value_type>(), threads());
+        }
+    };
+
+    // The colony iterators are not random access, sort a copy and write it back
+    template<class T>
+    struct Sort<plf::colony<T>> {
+        inline static void run(plf::colony<T> &c, std::size_t){
+            std::vector<T> copy(std::make_move_iterator(c.begin()), std::make_move_iterator(c.end()));
+            parallel_sort(copy.begin(), copy.end(), std::less<T>(), threads());
+            std::move(copy.begin(), copy.end(), c.begin());
+        }
+    };
+};
+
+#ifdef ARTICLES_HAS_EXECUTION
+
+template<class Container>
+struct ExecutionSort {
+    inline static void run(Container &c, std::size_t){
+        std::sort(std::execution::par_unseq, c.begin(), c.end());
+    }
+};
+
+#endif
+
 //Reverse the container
 
 template<class Container>
@@ -409,6 +1164,23 @@ struct Reverse<boost::intrusive::list<T, boost::intrusive::constant_time_size<fa
     }
 };
 
+//Compact the container
+
+template<class Container>
+struct Shrink {
+    inline static void run(Container &c, std::size_t){
+        c.shrink_to_fit();
+    }
+};
+
+// Change the group sizes of a colony, consolidating it into new groups
+template<class Container>
+struct Reshape {
+    inline static void run(Container &c, std::size_t){
+        c.change_group_sizes(64, 1024);
+    }
+};
+
 //Destroy the container
 
 template<class Container>
@@ -433,6 +1205,106 @@ struct RandomSortedInsert {
 template<class Container> std::mt19937 RandomSortedInsert<Container>::generator;
 template<class Container> std::uniform_int_distribution<std::size_t> RandomSortedInsert<Container>::distribution(0, std::numeric_limits<std::size_t>::max() - 1);
 
+// Sorted containers find the position themselves
+
+template<class T>
+struct RandomSortedInsert<flat_btree<T>> {
+    static std::mt19937 generator;
+    static std::uniform_int_distribution<std::size_t> distribution;
+
+    inline static void run(flat_btree<T> &c, std::size_t size){
+        for(std::size_t i=0; i<size; ++i){
+            c.insert({distribution(generator)});
+        }
+    }
+};
+
+template<class T> std::mt19937 RandomSortedInsert<flat_btree<T>>::generator;
+template<class T> std::uniform_int_distribution<std::size_t> RandomSortedInsert<flat_btree<T>>::distribution(0, std::numeric_limits<std::size_t>::max() - 1);
+
+template<class T>
+struct RandomSortedInsert<std::multiset<T>> {
+    static std::mt19937 generator;
+    static std::uniform_int_distribution<std::size_t> distribution;
+
+    inline static void run(std::multiset<T> &c, std::size_t size){
+        for(std::size_t i=0; i<size; ++i){
+            c.insert({distribution(generator)});
+        }
+    }
+};
+
+template<class T> std::mt19937 RandomSortedInsert<std::multiset<T>>::generator;
+template<class T> std::uniform_int_distribution<std::size_t> RandomSortedInsert<std::multiset<T>>::distribution(0, std::numeric_limits<std::size_t>::max() - 1);
+
+// Positioning by binary search in sorted containers, the linear policies
+// above find the same positions with a linear scan
+
+template<class Container>
+inline typename Container::iterator sorted_lower_bound(Container& c, std::size_t key){
+    // hand written comparison to eliminate temporary object creation
+    return std::lower_bound(std::begin(c), std::end(c), key, [](decltype(*std::begin(c)) v, std::size_t k){ return v.a < k; });
+}
+
+template<class T>
+inline typename indexed_list<T>::iterator sorted_lower_bound(indexed_list<T>& c, std::size_t key){
+    return c.lower_bound(key);
+}
+
+// The keys are uniformly distributed over the container, so that the same
+// number of elements is shifted as in Insert on a random container
+template<class Container>
+struct InsertBinary {
+    static std::mt19937 generator;
+
+    inline static void run(Container &c, std::size_t size){
+        std::uniform_int_distribution<std::size_t> distribution(0, size - 1);
+
+        for(std::size_t i=0; i<1000; ++i) {
+            auto key = distribution(generator);
+            c.insert(sorted_lower_bound(c, key), {key});
+        }
+    }
+};
+
+template<class Container> std::mt19937 InsertBinary<Container>::generator;
+
+template<class Container>
+struct EraseBinary {
+    static std::mt19937 generator;
+
+    inline static void run(Container &c, std::size_t size){
+        std::uniform_int_distribution<std::size_t> distribution(0, size - 1);
+
+        for(std::size_t i=0; i<1000; ++i) {
+            auto it = sorted_lower_bound(c, distribution(generator));
+
+            // The key may have already been erased, erase its successor
+            if(it != std::end(c)){
+                c.erase(it);
+            }
+        }
+    }
+};
+
+template<class Container> std::mt19937 EraseBinary<Container>::generator;
+
+template<class Container>
+struct RandomSortedInsertBinary {
+    static std::mt19937 generator;
+    static std::uniform_int_distribution<std::size_t> distribution;
+
+    inline static void run(Container &c, std::size_t size){
+        for(std::size_t i=0; i<size; ++i){
+            auto val = distribution(generator);
+            c.insert(sorted_lower_bound(c, val), {val});
+        }
+    }
+};
+
+template<class Container> std::mt19937 RandomSortedInsertBinary<Container>::generator;
+template<class Container> std::uniform_int_distribution<std::size_t> RandomSortedInsertBinary<Container>::distribution(0, std::numeric_limits<std::size_t>::max() - 1);
+
 template<class Container>
 struct RandomErase1 {
     static std::mt19937 generator;
@@ -519,7 +1391,7 @@ struct RandomErase50 {
 template<class Container> std::mt19937 RandomErase50<Container>::generator;
 template<class Container> std::uniform_int_distribution<std::size_t> RandomErase50<Container>::distribution(0, 10000);
 
-// Note: This is probably erased completely for a vector
+// The iterator must be computed, otherwise the loop is erased for a vector
 template<class Container>
 struct Traversal {
     inline static void run(Container &c, std::size_t size){
@@ -528,6 +1400,7 @@ struct Traversal {
 
         while(it != end){
             ++it;
+            do_not_optimize(it);
         }
     }
 };
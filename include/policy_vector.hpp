@@ -0,0 +1,775 @@
+//=======================================================================
+// Copyright (c) 2015 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#ifndef ARTICLES_POLICY_VECTOR
+#define ARTICLES_POLICY_VECTOR
+
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "configurable.hpp"
+#include "relocating_vector.hpp"
+
+/*
+ * The options of policy_vector, as named template parameters. All of them are
+ * optional and can be given in any order.
+ */
+namespace vector_policy {
+
+struct growth_id;
+struct inline_capacity_id;
+struct allocator_id;
+struct thread_safe_id;
+struct layout_id;
+
+//! The elements are stored one after another
+struct aos {};
+
+//! Each member of the std::tuple elements is stored in its own array
+struct soa {};
+
+//! The capacity is multiplied by G when the vector is full (default: 2)
+template<std::size_t G>
+struct growth : value_conf_t<growth_id, std::size_t, G> {};
+
+//! Up to N elements are stored inside the object itself (default: 0)
+template<std::size_t N>
+struct inline_capacity : value_conf_t<inline_capacity_id, std::size_t, N> {};
+
+//! The allocator template, instantiated by the vector (default: std::allocator)
+template<template<typename> class A>
+struct allocator : template_type_conf_t<allocator_id, A> {};
+
+//! The modifiers are serialized with a mutex
+struct thread_safe : basic_conf_t<thread_safe_id> {};
+
+//! The memory layout, aos or soa (default: aos)
+template<typename L>
+struct layout : type_conf_t<layout_id, L> {};
+
+} //end of namespace vector_policy
+
+namespace policy_vector_detail {
+
+template<std::size_t... I>
+struct indices {};
+
+template<std::size_t N, std::size_t... I>
+struct make_indices : make_indices<N - 1, N - 1, I...> {};
+
+template<std::size_t... I>
+struct make_indices<0, I...> {
+    using type = indices<I...>;
+};
+
+// Expand the expressions of a pack for their side effects
+using swallow = int[];
+
+constexpr std::size_t round_up(std::size_t bytes, std::size_t alignment){
+    return (bytes + alignment - 1) / alignment * alignment;
+}
+
+template<typename... T>
+struct max_alignment : std::integral_constant<std::size_t, 1> {};
+
+template<typename T, typename... Rest>
+struct max_alignment<T, Rest...> : std::integral_constant<std::size_t,
+    (alignof(T) > max_alignment<Rest...>::value ? alignof(T) : max_alignment<Rest...>::value)> {};
+
+// Move n objects to uninitialized memory and destroy them
+template<typename T>
+void relocate_range(T* from, T* to, std::size_t n, std::true_type){
+    if(n){
+        std::memcpy(static_cast<void*>(to), static_cast<void*>(from), n * sizeof(T));
+    }
+}
+
+template<typename T>
+void relocate_range(T* from, T* to, std::size_t n, std::false_type){
+    for(std::size_t i = 0; i < n; ++i){
+        ::new (to + i) T(std::move_if_noexcept(from[i]));
+        from[i].~T();
+    }
+}
+
+template<typename T>
+void relocate_range(T* from, T* to, std::size_t n){
+    relocate_range(from, to, n, std::integral_constant<bool, is_trivially_relocatable<T>::value>());
+}
+
+template<typename T>
+struct aos_layout {
+    using value_type      = T;
+    using reference       = T&;
+    using const_reference = const T&;
+    using iterator        = T*;
+    using const_iterator  = const T*;
+    using unit            = T;
+
+    static constexpr const std::size_t alignment = alignof(T);
+
+    static constexpr std::size_t bytes(std::size_t n){
+        return n * sizeof(T);
+    }
+
+    static constexpr std::size_t units(std::size_t n){
+        return n;
+    }
+
+    static T* data(unit* data){ return data; }
+    static const T* data(const unit* data){ return data; }
+
+    static reference get(unit* data, std::size_t, std::size_t i){ return data[i]; }
+    static const_reference get(const unit* data, std::size_t, std::size_t i){ return data[i]; }
+
+    static iterator make_iterator(unit* data, std::size_t, std::size_t i){ return data + i; }
+    static const_iterator make_iterator(const unit* data, std::size_t, std::size_t i){ return data + i; }
+
+    static std::size_t index(const unit* data, const_iterator it){
+        return it - data;
+    }
+
+    template<typename... Args>
+    static void construct(unit* data, std::size_t, std::size_t i, Args&&... args){
+        ::new (data + i) T(std::forward<Args>(args)...);
+    }
+
+    static void destroy(unit* data, std::size_t, std::size_t i){
+        data[i].~T();
+    }
+
+    static void copy(const unit* from, std::size_t, std::size_t i, unit* to, std::size_t, std::size_t j){
+        ::new (to + j) T(from[i]);
+    }
+
+    // Move the n first elements of from to to and destroy them
+    static void relocate_n(unit* from, std::size_t, unit* to, std::size_t, std::size_t n){
+        relocate_range(from, to, n);
+    }
+
+    static void move_construct(unit* data, std::size_t, std::size_t to, std::size_t from){
+        ::new (data + to) T(std::move(data[from]));
+    }
+
+    static void move_assign(unit* data, std::size_t, std::size_t to, std::size_t from){
+        data[to] = std::move(data[from]);
+    }
+
+    static void assign(unit* data, std::size_t, std::size_t i, T&& value){
+        data[i] = std::move(value);
+    }
+};
+
+// Offset of the column K of the Tuple elements, in a buffer of capacity n
+template<std::size_t K, typename Tuple, std::size_t Alignment>
+struct column_offset {
+    static constexpr std::size_t get(std::size_t n){
+        return column_offset<K - 1, Tuple, Alignment>::get(n)
+            + round_up(n * sizeof(typename std::tuple_element<K - 1, Tuple>::type), Alignment);
+    }
+};
+
+template<typename Tuple, std::size_t Alignment>
+struct column_offset<0, Tuple, Alignment> {
+    static constexpr std::size_t get(std::size_t){
+        return 0;
+    }
+};
+
+template<typename Layout, typename Unit, typename Reference>
+class soa_iterator {
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type        = typename Layout::value_type;
+    using difference_type   = std::ptrdiff_t;
+    using reference         = Reference;
+    using pointer           = void;
+
+    soa_iterator() = default;
+    soa_iterator(Unit* data, std::size_t capacity, std::size_t i) : data(data), capacity(capacity), i(i) {}
+
+    //! Conversion from iterator to const_iterator
+    template<typename U, typename R>
+    soa_iterator(const soa_iterator<Layout, U, R>& rhs) : data(rhs.data), capacity(rhs.capacity), i(rhs.i) {}
+
+    reference operator*() const { return Layout::get(data, capacity, i); }
+    reference operator[](difference_type n) const { return Layout::get(data, capacity, i + n); }
+
+    soa_iterator& operator++(){ ++i; return *this; }
+    soa_iterator& operator--(){ --i; return *this; }
+    soa_iterator operator++(int){ auto it = *this; ++i; return it; }
+    soa_iterator operator--(int){ auto it = *this; --i; return it; }
+
+    soa_iterator& operator+=(difference_type n){ i += n; return *this; }
+    soa_iterator& operator-=(difference_type n){ i -= n; return *this; }
+
+    soa_iterator operator+(difference_type n) const { return {data, capacity, i + n}; }
+    soa_iterator operator-(difference_type n) const { return {data, capacity, i - n}; }
+
+    difference_type operator-(const soa_iterator& rhs) const { return difference_type(i) - difference_type(rhs.i); }
+
+    bool operator==(const soa_iterator& rhs) const { return i == rhs.i; }
+    bool operator!=(const soa_iterator& rhs) const { return i != rhs.i; }
+    bool operator<(const soa_iterator& rhs) const { return i < rhs.i; }
+
+private:
+    template<typename L, typename U, typename R>
+    friend class soa_iterator;
+
+    template<typename T>
+    friend struct soa_layout;
+
+    Unit* data = nullptr;
+    std::size_t capacity = 0;
+    std::size_t i = 0;
+};
+
+template<typename T>
+struct soa_layout {
+    static_assert(!std::is_same<T, T>::value, "layout<soa> needs std::tuple elements");
+};
+
+template<typename... T>
+struct soa_layout<std::tuple<T...>> {
+    using value_type      = std::tuple<T...>;
+    using reference       = std::tuple<T&...>;
+    using const_reference = std::tuple<const T&...>;
+
+    static constexpr const std::size_t alignment = max_alignment<T...>::value;
+
+    using unit            = typename std::aligned_storage<alignment, alignment>::type;
+    using iterator        = soa_iterator<soa_layout, unit, reference>;
+    using const_iterator  = soa_iterator<soa_layout, const unit, const_reference>;
+    using columns         = typename make_indices<sizeof...(T)>::type;
+
+    template<std::size_t K>
+    using column_type = typename std::tuple_element<K, value_type>::type;
+
+    static constexpr std::size_t bytes(std::size_t n){
+        return column_offset<sizeof...(T), value_type, alignment>::get(n);
+    }
+
+    static constexpr std::size_t units(std::size_t n){
+        return bytes(n) / alignment;
+    }
+
+    //! The array of the members K of the elements
+    template<std::size_t K>
+    static column_type<K>* column(unit* data, std::size_t capacity){
+        return reinterpret_cast<column_type<K>*>(reinterpret_cast<char*>(data) + column_offset<K, value_type, alignment>::get(capacity));
+    }
+
+    template<std::size_t K>
+    static const column_type<K>* column(const unit* data, std::size_t capacity){
+        return reinterpret_cast<const column_type<K>*>(reinterpret_cast<const char*>(data) + column_offset<K, value_type, alignment>::get(capacity));
+    }
+
+    static reference get(unit* data, std::size_t capacity, std::size_t i){
+        return get(data, capacity, i, columns());
+    }
+
+    static const_reference get(const unit* data, std::size_t capacity, std::size_t i){
+        return get(data, capacity, i, columns());
+    }
+
+    static iterator make_iterator(unit* data, std::size_t capacity, std::size_t i){ return {data, capacity, i}; }
+    static const_iterator make_iterator(const unit* data, std::size_t capacity, std::size_t i){ return {data, capacity, i}; }
+
+    static std::size_t index(const unit*, const_iterator it){
+        return it.i;
+    }
+
+    static void construct(unit* data, std::size_t capacity, std::size_t i){
+        construct_default(data, capacity, i, columns());
+    }
+
+    static void construct(unit* data, std::size_t capacity, std::size_t i, const value_type& value){
+        construct_tuple(data, capacity, i, value, columns());
+    }
+
+    static void construct(unit* data, std::size_t capacity, std::size_t i, value_type&& value){
+        construct_tuple(data, capacity, i, std::move(value), columns());
+    }
+
+    //! Construct each member from one of the arguments
+    template<typename... Args, typename = typename std::enable_if<sizeof...(Args) == sizeof...(T)>::type>
+    static void construct(unit* data, std::size_t capacity, std::size_t i, Args&&... args){
+        construct_members(data, capacity, i, columns(), std::forward<Args>(args)...);
+    }
+
+    static void destroy(unit* data, std::size_t capacity, std::size_t i){
+        destroy(data, capacity, i, columns());
+    }
+
+    static void copy(const unit* from, std::size_t from_capacity, std::size_t i, unit* to, std::size_t to_capacity, std::size_t j){
+        copy(from, from_capacity, i, to, to_capacity, j, columns());
+    }
+
+    static void relocate_n(unit* from, std::size_t from_capacity, unit* to, std::size_t to_capacity, std::size_t n){
+        relocate_n(from, from_capacity, to, to_capacity, n, columns());
+    }
+
+    static void move_construct(unit* data, std::size_t capacity, std::size_t to, std::size_t from){
+        move_construct(data, capacity, to, from, columns());
+    }
+
+    static void move_assign(unit* data, std::size_t capacity, std::size_t to, std::size_t from){
+        move_assign(data, capacity, to, from, columns());
+    }
+
+    static void assign(unit* data, std::size_t capacity, std::size_t i, value_type&& value){
+        assign(data, capacity, i, std::move(value), columns());
+    }
+
+private:
+    template<std::size_t... K>
+    static reference get(unit* data, std::size_t capacity, std::size_t i, indices<K...>){
+        return reference(column<K>(data, capacity)[i]...);
+    }
+
+    template<std::size_t... K>
+    static const_reference get(const unit* data, std::size_t capacity, std::size_t i, indices<K...>){
+        return const_reference(column<K>(data, capacity)[i]...);
+    }
+
+    template<std::size_t... K>
+    static void construct_default(unit* data, std::size_t capacity, std::size_t i, indices<K...>){
+        (void) swallow{0, (::new (column<K>(data, capacity) + i) T(), 0)...};
+    }
+
+    template<typename Tuple, std::size_t... K>
+    static void construct_tuple(unit* data, std::size_t capacity, std::size_t i, Tuple&& value, indices<K...>){
+        (void) swallow{0, (::new (column<K>(data, capacity) + i) T(std::get<K>(std::forward<Tuple>(value))), 0)...};
+    }
+
+    template<std::size_t... K, typename... Args>
+    static void construct_members(unit* data, std::size_t capacity, std::size_t i, indices<K...>, Args&&... args){
+        (void) swallow{0, (::new (column<K>(data, capacity) + i) T(std::forward<Args>(args)), 0)...};
+    }
+
+    template<std::size_t... K>
+    static void destroy(unit* data, std::size_t capacity, std::size_t i, indices<K...>){
+        (void) swallow{0, (column<K>(data, capacity)[i].~T(), 0)...};
+    }
+
+    template<std::size_t... K>
+    static void copy(const unit* from, std::size_t from_capacity, std::size_t i, unit* to, std::size_t to_capacity, std::size_t j, indices<K...>){
+        (void) swallow{0, (::new (column<K>(to, to_capacity) + j) T(column<K>(from, from_capacity)[i]), 0)...};
+    }
+
+    template<std::size_t... K>
+    static void relocate_n(unit* from, std::size_t from_capacity, unit* to, std::size_t to_capacity, std::size_t n, indices<K...>){
+        (void) swallow{0, (relocate_range(column<K>(from, from_capacity), column<K>(to, to_capacity), n), 0)...};
+    }
+
+    template<std::size_t... K>
+    static void move_construct(unit* data, std::size_t capacity, std::size_t to, std::size_t from, indices<K...>){
+        (void) swallow{0, (::new (column<K>(data, capacity) + to) T(std::move(column<K>(data, capacity)[from])), 0)...};
+    }
+
+    template<std::size_t... K>
+    static void move_assign(unit* data, std::size_t capacity, std::size_t to, std::size_t from, indices<K...>){
+        (void) swallow{0, (column<K>(data, capacity)[to] = std::move(column<K>(data, capacity)[from]), 0)...};
+    }
+
+    template<std::size_t... K>
+    static void assign(unit* data, std::size_t capacity, std::size_t i, value_type&& value, indices<K...>){
+        (void) swallow{0, (column<K>(data, capacity)[i] = std::move(std::get<K>(value)), 0)...};
+    }
+};
+
+template<typename L, typename T>
+struct layout_of;
+
+template<typename T>
+struct layout_of<vector_policy::aos, T> {
+    using type = aos_layout<T>;
+};
+
+template<typename T>
+struct layout_of<vector_policy::soa, T> {
+    using type = soa_layout<T>;
+};
+
+// The locks are const, the source of a copy is locked as well
+struct unlocked {
+    void lock() const {}
+    bool try_lock() const { return true; }
+    void unlock() const {}
+};
+
+// A mutex that is not copied with the vector
+struct locked {
+    mutable std::mutex mutex;
+
+    locked() = default;
+    locked(const locked&){}
+    locked& operator=(const locked&){ return *this; }
+
+    void lock() const { mutex.lock(); }
+    bool try_lock() const { return mutex.try_lock(); }
+    void unlock() const { mutex.unlock(); }
+};
+
+template<typename Layout, std::size_t N>
+struct inline_storage {
+    typename std::aligned_storage<Layout::bytes(N), Layout::alignment>::type storage;
+
+    typename Layout::unit* inline_data(){
+        return reinterpret_cast<typename Layout::unit*>(&storage);
+    }
+
+    const typename Layout::unit* inline_data() const {
+        return reinterpret_cast<const typename Layout::unit*>(&storage);
+    }
+};
+
+// Without inline capacity, the empty vector has no storage at all
+template<typename Layout>
+struct inline_storage<Layout, 0> {
+    typename Layout::unit* inline_data(){ return nullptr; }
+    const typename Layout::unit* inline_data() const { return nullptr; }
+};
+
+template<typename T, typename... Options>
+struct options {
+    static_assert(
+        is_valid<tmp_list<vector_policy::growth_id, vector_policy::inline_capacity_id, vector_policy::allocator_id,
+            vector_policy::thread_safe_id, vector_policy::layout_id>, Options...>::value,
+        "Invalid policy_vector option");
+
+    static constexpr const std::size_t growth = get_value<vector_policy::growth<2>, Options...>::value;
+    static constexpr const std::size_t inline_capacity = get_value<vector_policy::inline_capacity<0>, Options...>::value;
+    static constexpr const bool thread_safe = is_present<vector_policy::thread_safe, Options...>::value;
+
+    static_assert(growth > 1, "policy_vector must grow by a factor of at least 2");
+
+    using layout = typename layout_of<typename get_type<vector_policy::layout<vector_policy::aos>, Options...>::value, T>::type;
+    using allocator = typename get_template_type<vector_policy::allocator<std::allocator>, Options...>::template value<typename layout::unit>;
+    using lock = typename std::conditional<thread_safe, locked, unlocked>::type;
+};
+
+} //end of namespace policy_vector_detail
+
+/*!
+ * \brief Vector configured at compile time with the options of vector_policy.
+ *
+ * The options that are not used do not cost anything: the empty allocator,
+ * lock and inline storage take no space, so policy_vector<T> has the size and
+ * the code of a plain vector. With layout<soa>, the elements must be
+ * std::tuple, the references are tuples of references and each member is
+ * available as a contiguous array with column<K>().
+ *
+ * The thread safe vectors only serialize the modifiers, the elements and the
+ * iterators are not protected.
+ */
+template<typename T, typename... Options>
+class policy_vector {
+    using config    = policy_vector_detail::options<T, Options...>;
+    using layout    = typename config::layout;
+    using unit      = typename layout::unit;
+    using traits    = std::allocator_traits<typename config::allocator>;
+    using lock_type = typename config::lock;
+    using guard     = std::lock_guard<const lock_type>;
+
+    static constexpr const std::size_t N = config::inline_capacity;
+
+    // Only the inline elements are moved one by one, the storage is stolen
+    static constexpr const bool nothrow_move = N == 0 || std::is_nothrow_move_constructible<T>::value;
+
+public:
+    using value_type      = T;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference       = typename layout::reference;
+    using const_reference = typename layout::const_reference;
+    using iterator        = typename layout::iterator;
+    using const_iterator  = typename layout::const_iterator;
+    using allocator_type  = typename config::allocator;
+
+    policy_vector() = default;
+
+    policy_vector(const policy_vector& rhs){
+        guard lock(rhs.impl);
+        copy_from(rhs);
+    }
+
+    policy_vector(policy_vector&& rhs) noexcept(nothrow_move) {
+        steal(rhs);
+    }
+
+    policy_vector& operator=(const policy_vector& rhs){
+        if(this != &rhs){
+            std::lock(impl, rhs.impl);
+            guard lock(impl, std::adopt_lock);
+            guard rhs_lock(rhs.impl, std::adopt_lock);
+
+            destroy_all();
+            copy_from(rhs);
+        }
+
+        return *this;
+    }
+
+    policy_vector& operator=(policy_vector&& rhs) noexcept(nothrow_move) {
+        if(this != &rhs){
+            guard lock(impl);
+            destroy_all();
+            release();
+            steal(rhs);
+        }
+
+        return *this;
+    }
+
+    ~policy_vector(){
+        destroy_all();
+        release();
+    }
+
+    iterator begin(){ return layout::make_iterator(impl.first, impl.limit, 0); }
+    iterator end(){ return layout::make_iterator(impl.first, impl.limit, impl.elements); }
+
+    const_iterator begin() const { return layout::make_iterator(const_first(), impl.limit, 0); }
+    const_iterator end() const { return layout::make_iterator(const_first(), impl.limit, impl.elements); }
+
+    size_type size() const {
+        return impl.elements;
+    }
+
+    size_type capacity() const {
+        return impl.limit;
+    }
+
+    bool empty() const {
+        return impl.elements == 0;
+    }
+
+    //! Indicates if the elements are stored inside the object
+    bool is_inline() const {
+        return const_first() == impl.inline_data();
+    }
+
+    reference operator[](size_type i){ return layout::get(impl.first, impl.limit, i); }
+    const_reference operator[](size_type i) const { return layout::get(const_first(), impl.limit, i); }
+
+    reference front(){ return (*this)[0]; }
+    const_reference front() const { return (*this)[0]; }
+
+    reference back(){ return (*this)[impl.elements - 1]; }
+    const_reference back() const { return (*this)[impl.elements - 1]; }
+
+    //! The contiguous elements, only with the aos layout
+    template<typename L = layout>
+    auto data() -> decltype(L::data(std::declval<unit*>())) {
+        return L::data(impl.first);
+    }
+
+    //! The contiguous array of the members K, only with the soa layout
+    template<std::size_t K, typename L = layout>
+    auto column() -> decltype(L::template column<K>(std::declval<unit*>(), 0)) {
+        return L::template column<K>(impl.first, impl.limit);
+    }
+
+    void reserve(size_type n){
+        guard lock(impl);
+
+        if(n > impl.limit){
+            reallocate(n);
+        }
+    }
+
+    void push_back(const value_type& value){
+        emplace_back(value);
+    }
+
+    void push_back(value_type&& value){
+        emplace_back(std::move(value));
+    }
+
+    template<typename... Args>
+    void emplace_back(Args&&... args){
+        guard lock(impl);
+
+        if(impl.elements == impl.limit){
+            // The value may alias an element that is about to be moved
+            value_type value(std::forward<Args>(args)...);
+            grow(impl.elements + 1);
+            layout::construct(impl.first, impl.limit, impl.elements, std::move(value));
+        } else {
+            layout::construct(impl.first, impl.limit, impl.elements, std::forward<Args>(args)...);
+        }
+
+        ++impl.elements;
+    }
+
+    iterator insert(const_iterator position, const value_type& value){
+        return emplace(position, value);
+    }
+
+    iterator insert(const_iterator position, value_type&& value){
+        return emplace(position, std::move(value));
+    }
+
+    template<typename... Args>
+    iterator emplace(const_iterator position, Args&&... args){
+        guard lock(impl);
+
+        auto i = layout::index(const_first(), position);
+
+        value_type value(std::forward<Args>(args)...);
+
+        if(impl.elements == impl.limit){
+            grow(impl.elements + 1);
+        }
+
+        if(i == impl.elements){
+            layout::construct(impl.first, impl.limit, i, std::move(value));
+        } else {
+            layout::move_construct(impl.first, impl.limit, impl.elements, impl.elements - 1);
+
+            for(size_type j = impl.elements - 1; j > i; --j){
+                layout::move_assign(impl.first, impl.limit, j, j - 1);
+            }
+
+            layout::assign(impl.first, impl.limit, i, std::move(value));
+        }
+
+        ++impl.elements;
+
+        return layout::make_iterator(impl.first, impl.limit, i);
+    }
+
+    iterator erase(const_iterator position){
+        return erase(position, std::next(position));
+    }
+
+    iterator erase(const_iterator first, const_iterator last){
+        guard lock(impl);
+
+        auto i = layout::index(const_first(), first);
+        auto n = layout::index(const_first(), last) - i;
+
+        if(n){
+            for(size_type j = i; j + n < impl.elements; ++j){
+                layout::move_assign(impl.first, impl.limit, j, j + n);
+            }
+
+            for(size_type j = impl.elements - n; j < impl.elements; ++j){
+                layout::destroy(impl.first, impl.limit, j);
+            }
+
+            impl.elements -= n;
+        }
+
+        return layout::make_iterator(impl.first, impl.limit, i);
+    }
+
+    void pop_back(){
+        guard lock(impl);
+        layout::destroy(impl.first, impl.limit, --impl.elements);
+    }
+
+    void clear(){
+        guard lock(impl);
+        destroy_all();
+    }
+
+private:
+    /*
+     * The empty bases take no space, the vector is only made of the three
+     * members when there is no inline storage.
+     */
+    struct impl_type : config::allocator, lock_type, policy_vector_detail::inline_storage<layout, N> {
+        unit* first = this->inline_data();
+        size_type elements = 0;
+        size_type limit = N;
+    };
+
+    impl_type impl;
+
+    const unit* const_first() const {
+        return impl.first;
+    }
+
+    typename config::allocator& allocator(){
+        return impl;
+    }
+
+    void grow(size_type n){
+        auto limit = impl.limit * config::growth;
+        reallocate(n > limit ? n : limit);
+    }
+
+    void reallocate(size_type n){
+        unit* memory = traits::allocate(allocator(), layout::units(n));
+
+        layout::relocate_n(impl.first, impl.limit, memory, n, impl.elements);
+
+        release();
+
+        impl.first = memory;
+        impl.limit = n;
+    }
+
+    void destroy_all(){
+        for(size_type i = 0; i < impl.elements; ++i){
+            layout::destroy(impl.first, impl.limit, i);
+        }
+
+        impl.elements = 0;
+    }
+
+    // Free the allocated storage, if any, the elements must have been destroyed
+    void release(){
+        if(!is_inline()){
+            traits::deallocate(allocator(), impl.first, layout::units(impl.limit));
+            impl.first = impl.inline_data();
+            impl.limit = N;
+        }
+    }
+
+    // The vector must be empty and rhs must be locked
+    void copy_from(const policy_vector& rhs){
+        if(rhs.size() > impl.limit){
+            reallocate(rhs.size());
+        }
+
+        for(size_type i = 0; i < rhs.size(); ++i){
+            layout::copy(rhs.const_first(), rhs.impl.limit, i, impl.first, impl.limit, i);
+        }
+
+        impl.elements = rhs.impl.elements;
+    }
+
+    // Take the elements of rhs, only moving them if they are inline
+    void steal(policy_vector& rhs){
+        if(rhs.is_inline()){
+            layout::relocate_n(rhs.impl.first, rhs.impl.limit, impl.first, impl.limit, rhs.impl.elements);
+
+            impl.elements = rhs.impl.elements;
+            rhs.impl.elements = 0;
+        } else {
+            impl.first = rhs.impl.first;
+            impl.elements = rhs.impl.elements;
+            impl.limit = rhs.impl.limit;
+
+            rhs.impl.first = rhs.impl.inline_data();
+            rhs.impl.elements = 0;
+            rhs.impl.limit = N;
+        }
+    }
+};
+
+#endif
@@ -0,0 +1,499 @@
+//=======================================================================
+// Copyright (c) 2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#ifndef ARTICLES_POW
+#define ARTICLES_POW
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+//! Compute x^n with n multiplications
+template<typename T>
+inline T my_pow(T x, std::size_t n){
+    T r = 1.0;
+
+    while(n > 0){
+        r *= x;
+        --n;
+    }
+
+    return r;
+}
+
+//! Compute x^n by multiplying the powers of x matching the set bits of n
+template<typename T>
+inline T second_pow(T x, std::size_t n){
+    T r = 1.0;
+    T tmp = 1.0;
+    int curr = 1;
+
+    while(n){
+        tmp = tmp * x;
+        if (n & curr){
+            r *= tmp;
+            n = n & ~curr;
+        }
+
+        ++curr;
+    }
+
+    return r;
+}
+
+//! Compute x^n with binary exponentiation
+template<typename T>
+inline T third_pow(T x, std::size_t y) {
+    T z = 1;
+    T base = x;
+
+    while (y) {
+        if (y & 1) {
+            z *= base;
+        }
+        y >>= 1;
+        base *= base;
+    }
+
+    return z;
+}
+
+//! Exponents handled by the jump table of fast_pow and by the optimal chains of ct_pow
+static constexpr std::size_t fast_pow_table_size = 32;
+
+namespace pow_detail {
+
+constexpr std::size_t smallest_factor(std::size_t n, std::size_t f = 2){
+    return f * f > n ? n : (n % f == 0 ? f : smallest_factor(n, f + 1));
+}
+
+constexpr std::size_t min(std::size_t a, std::size_t b){
+    return a < b ? a : b;
+}
+
+constexpr std::size_t multiplications(std::size_t n);
+
+// x^n = (x^(n/2))^2 or x * x^(n-1)
+constexpr std::size_t binary_multiplications(std::size_t n){
+    return n % 2 == 0 ? multiplications(n / 2) + 1 : multiplications(n - 1) + 1;
+}
+
+// x^n = (x^p)^(n/p) with p the smallest prime factor of n
+constexpr std::size_t factor_multiplications(std::size_t n){
+    return multiplications(smallest_factor(n)) + multiplications(n / smallest_factor(n));
+}
+
+constexpr bool use_factor(std::size_t n){
+    return n > 1 && smallest_factor(n) != n && factor_multiplications(n) < binary_multiplications(n);
+}
+
+// Length of the optimal addition chains of the exponents below fast_pow_table_size
+constexpr std::size_t optimal_multiplications[fast_pow_table_size] = {0, 0, 1, 2, 2, 3, 3, 4, 3, 4, 4, 5, 4, 5, 5, 5, 4, 5, 5, 6, 5, 6, 6, 6, 5, 6, 6, 6, 6, 7, 6, 7};
+
+// Number of multiplications of the chain used by ct_pow<n>
+constexpr std::size_t multiplications(std::size_t n){
+    return n < fast_pow_table_size ? optimal_multiplications[n]
+        : smallest_factor(n) != n ? min(binary_multiplications(n), factor_multiplications(n)) : binary_multiplications(n);
+}
+
+// Step of an addition chain, the next power is the product of the powers
+// First and Second of the chain, the power 0 being x
+template<std::size_t First, std::size_t Second>
+struct step {};
+
+template<typename... Steps>
+struct steps {};
+
+// Optimal addition chains of the exponents below fast_pow_table_size, the
+// powers of the chain follow each chain
+template<std::size_t N>
+struct optimal_chain;
+
+template<> struct optimal_chain<2> { using type = steps<step<0, 0>>; }; // 1 2
+template<> struct optimal_chain<3> { using type = steps<step<0, 0>, step<1, 0>>; }; // 1 2 3
+template<> struct optimal_chain<4> { using type = steps<step<0, 0>, step<1, 1>>; }; // 1 2 4
+template<> struct optimal_chain<5> { using type = steps<step<0, 0>, step<1, 1>, step<2, 0>>; }; // 1 2 4 5
+template<> struct optimal_chain<6> { using type = steps<step<0, 0>, step<1, 1>, step<2, 1>>; }; // 1 2 4 6
+template<> struct optimal_chain<7> { using type = steps<step<0, 0>, step<1, 1>, step<2, 1>, step<3, 0>>; }; // 1 2 4 6 7
+template<> struct optimal_chain<8> { using type = steps<step<0, 0>, step<1, 1>, step<2, 2>>; }; // 1 2 4 8
+template<> struct optimal_chain<9> { using type = steps<step<0, 0>, step<1, 1>, step<2, 2>, step<3, 0>>; }; // 1 2 4 8 9
+template<> struct optimal_chain<10> { using type = steps<step<0, 0>, step<1, 1>, step<2, 2>, step<3, 1>>; }; // 1 2 4 8 10
+template<> struct optimal_chain<11> { using type = steps<step<0, 0>, step<1, 1>, step<2, 2>, step<3, 1>, step<4, 0>>; }; // 1 2 4 8 10 11
+template<> struct optimal_chain<12> { using type = steps<step<0, 0>, step<1, 1>, step<2, 2>, step<3, 2>>; }; // 1 2 4 8 12
+template<> struct optimal_chain<13> { using type = steps<step<0, 0>, step<1, 1>, step<2, 2>, step<3, 2>, step<4, 0>>; }; // 1 2 4 8 12 13
+template<> struct optimal_chain<14> { using type = steps<step<0, 0>, step<1, 1>, step<2, 2>, step<3, 2>, step<4, 1>>; }; // 1 2 4 8 12 14
+template<> struct optimal_chain<15> { using type = steps<step<0, 0>, step<1, 1>, step<2, 0>, step<3, 3>, step<4, 3>>; }; // 1 2 4 5 10 15
+template<> struct optimal_chain<16> { using type = steps<step<0, 0>, step<1, 1>, step<2, 2>, step<3, 3>>; }; // 1 2 4 8 16
+template<> struct optimal_chain<17> { using type = steps<step<0, 0>, step<1, 1>, step<2, 2>, step<3, 3>, step<4, 0>>; }; // 1 2 4 8 16 17
+template<> struct optimal_chain<18> { using type = steps<step<0, 0>, step<1, 1>, step<2, 2>, step<3, 3>, step<4, 1>>; }; // 1 2 4 8 16 18
+template<> struct optimal_chain<19> { using type = steps<step<0, 0>, step<1, 1>, step<2, 2>, step<3, 3>, step<4, 1>, step<5, 0>>; }; // 1 2 4 8 16 18 19
+template<> struct optimal_chain<20> { using type = steps<step<0, 0>, step<1, 1>, step<2, 2>, step<3, 3>, step<4, 2>>; }; // 1 2 4 8 16 20
+template<> struct optimal_chain<21> { using type = steps<step<0, 0>, step<1, 1>, step<2, 2>, step<3, 3>, step<4, 2>, step<5, 0>>; }; // 1 2 4 8 16 20 21
+template<> struct optimal_chain<22> { using type = steps<step<0, 0>, step<1, 1>, step<2, 2>, step<3, 3>, step<4, 2>, step<5, 1>>; }; // 1 2 4 8 16 20 22
+template<> struct optimal_chain<23> { using type = steps<step<0, 0>, step<1, 1>, step<2, 0>, step<3, 2>, step<4, 4>, step<5, 3>>; }; // 1 2 4 5 9 18 23
+template<> struct optimal_chain<24> { using type = steps<step<0, 0>, step<1, 1>, step<2, 2>, step<3, 3>, step<4, 3>>; }; // 1 2 4 8 16 24
+template<> struct optimal_chain<25> { using type = steps<step<0, 0>, step<1, 1>, step<2, 2>, step<3, 3>, step<4, 3>, step<5, 0>>; }; // 1 2 4 8 16 24 25
+template<> struct optimal_chain<26> { using type = steps<step<0, 0>, step<1, 1>, step<2, 2>, step<3, 3>, step<4, 3>, step<5, 1>>; }; // 1 2 4 8 16 24 26
+template<> struct optimal_chain<27> { using type = steps<step<0, 0>, step<1, 1>, step<2, 2>, step<3, 0>, step<4, 4>, step<5, 4>>; }; // 1 2 4 8 9 18 27
+template<> struct optimal_chain<28> { using type = steps<step<0, 0>, step<1, 1>, step<2, 2>, step<3, 3>, step<4, 3>, step<5, 2>>; }; // 1 2 4 8 16 24 28
+template<> struct optimal_chain<29> { using type = steps<step<0, 0>, step<1, 1>, step<2, 2>, step<3, 3>, step<4, 3>, step<5, 2>, step<6, 0>>; }; // 1 2 4 8 16 24 28 29
+template<> struct optimal_chain<30> { using type = steps<step<0, 0>, step<1, 1>, step<2, 2>, step<3, 1>, step<4, 4>, step<5, 4>>; }; // 1 2 4 8 10 20 30
+template<> struct optimal_chain<31> { using type = steps<step<0, 0>, step<1, 1>, step<2, 2>, step<3, 1>, step<4, 4>, step<5, 4>, step<6, 0>>; }; // 1 2 4 8 10 20 30 31
+
+template<typename Steps>
+struct run_steps;
+
+template<>
+struct run_steps<steps<>> {
+    template<typename T, typename... P>
+    static T apply(T last, P...){
+        return last;
+    }
+};
+
+// The powers computed so far are passed from the last one to x
+template<std::size_t First, std::size_t Second, typename... Steps>
+struct run_steps<steps<step<First, Second>, Steps...>> {
+    template<typename T, typename... P>
+    static T apply(T last, P... powers){
+        auto all = std::forward_as_tuple(last, powers...);
+        return run_steps<steps<Steps...>>::apply(std::get<sizeof...(P) - First>(all) * std::get<sizeof...(P) - Second>(all), last, powers...);
+    }
+};
+
+template<std::size_t N>
+struct chain;
+
+// Use the optimal chain of the table or select the shortest of the binary and
+// the factor chains
+template<std::size_t N>
+using chain_kind = std::integral_constant<int, N < fast_pow_table_size ? 3 : use_factor(N) ? 2 : N % 2 == 0 ? 1 : 0>;
+
+template<std::size_t N>
+struct chain {
+    template<typename T>
+    static T compute(T x){
+        return compute(x, chain_kind<N>());
+    }
+
+    template<typename T>
+    static T compute(T x, std::integral_constant<int, 0>){
+        return x * chain<N - 1>::compute(x);
+    }
+
+    template<typename T>
+    static T compute(T x, std::integral_constant<int, 1>){
+        T half = chain<N / 2>::compute(x);
+        return half * half;
+    }
+
+    template<typename T>
+    static T compute(T x, std::integral_constant<int, 2>){
+        return chain<N / smallest_factor(N)>::compute(chain<smallest_factor(N)>::compute(x));
+    }
+
+    template<typename T>
+    static T compute(T x, std::integral_constant<int, 3>){
+        return run_steps<typename optimal_chain<N>::type>::apply(x);
+    }
+};
+
+template<>
+struct chain<1> {
+    template<typename T>
+    static T compute(T x){
+        return x;
+    }
+};
+
+template<>
+struct chain<0> {
+    template<typename T>
+    static T compute(T){
+        return T(1);
+    }
+};
+
+template<std::size_t... I>
+struct indices {};
+
+template<std::size_t N, std::size_t... I>
+struct make_indices : make_indices<N - 1, N - 1, I...> {};
+
+template<std::size_t... I>
+struct make_indices<0, I...> {
+    using type = indices<I...>;
+};
+
+} //end of namespace pow_detail
+
+/*!
+ * \brief Compute x^N with a chain of multiplications unrolled at compile-time.
+ *
+ * Below fast_pow_table_size, the chain is an optimal addition chain from a
+ * table, for instance x^23 is computed with 6 multiplications as x^2, x^4,
+ * x^5, x^9, x^18 and x^23. Above, the chain is the shortest of the binary
+ * method and the factor method, for instance x^45 is computed as (x^3)^15.
+ */
+template<std::size_t N, typename T>
+inline T ct_pow(T x){
+    return pow_detail::chain<N>::compute(x);
+}
+
+//! Number of multiplications done by ct_pow<N>
+template<std::size_t N>
+constexpr std::size_t ct_pow_multiplications(){
+    return pow_detail::multiplications(N);
+}
+
+namespace pow_detail {
+
+template<typename T, typename Indices>
+struct pow_table;
+
+template<typename T, std::size_t... I>
+struct pow_table<T, indices<I...>> {
+    static constexpr T (*table[sizeof...(I)])(T) = {&ct_pow<I, T>...};
+};
+
+template<typename T, std::size_t... I>
+constexpr T (*pow_table<T, indices<I...>>::table[sizeof...(I)])(T);
+
+} //end of namespace pow_detail
+
+/*!
+ * \brief Compute x^n, dispatching to ct_pow through a jump table for the small
+ * exponents and with binary exponentiation for the others.
+ */
+template<typename T>
+inline T fast_pow(T x, std::size_t n){
+    if(n < fast_pow_table_size){
+        return pow_detail::pow_table<T, typename pow_detail::make_indices<fast_pow_table_size>::type>::table[n](x);
+    }
+
+    T r = 1;
+
+    while(n){
+        if(n & 1){
+            r *= x;
+        }
+
+        n >>= 1;
+        x *= x;
+    }
+
+    return r;
+}
+
+namespace pow_detail {
+
+// Packs of values processed together by the batch kernels, ct_pow works
+// directly on them
+
+#if defined(__AVX__)
+
+struct double_pack {
+    static constexpr std::size_t size = 4;
+
+    __m256d v;
+
+    double_pack(__m256d v) : v(v) {}
+    explicit double_pack(double x) : v(_mm256_set1_pd(x)) {}
+
+    static double_pack load(const double* p){ return _mm256_loadu_pd(p); }
+    void store(double* p) const { _mm256_storeu_pd(p, v); }
+};
+
+inline double_pack operator*(double_pack a, double_pack b){
+    return _mm256_mul_pd(a.v, b.v);
+}
+
+struct float_pack {
+    static constexpr std::size_t size = 8;
+
+    __m256 v;
+
+    float_pack(__m256 v) : v(v) {}
+    explicit float_pack(float x) : v(_mm256_set1_ps(x)) {}
+
+    static float_pack load(const float* p){ return _mm256_loadu_ps(p); }
+    void store(float* p) const { _mm256_storeu_ps(p, v); }
+};
+
+inline float_pack operator*(float_pack a, float_pack b){
+    return _mm256_mul_ps(a.v, b.v);
+}
+
+#elif defined(__SSE2__)
+
+struct double_pack {
+    static constexpr std::size_t size = 2;
+
+    __m128d v;
+
+    double_pack(__m128d v) : v(v) {}
+    explicit double_pack(double x) : v(_mm_set1_pd(x)) {}
+
+    static double_pack load(const double* p){ return _mm_loadu_pd(p); }
+    void store(double* p) const { _mm_storeu_pd(p, v); }
+};
+
+inline double_pack operator*(double_pack a, double_pack b){
+    return _mm_mul_pd(a.v, b.v);
+}
+
+struct float_pack {
+    static constexpr std::size_t size = 4;
+
+    __m128 v;
+
+    float_pack(__m128 v) : v(v) {}
+    explicit float_pack(float x) : v(_mm_set1_ps(x)) {}
+
+    static float_pack load(const float* p){ return _mm_loadu_ps(p); }
+    void store(float* p) const { _mm_storeu_ps(p, v); }
+};
+
+inline float_pack operator*(float_pack a, float_pack b){
+    return _mm_mul_ps(a.v, b.v);
+}
+
+#else
+
+template<typename T>
+struct scalar_pack {
+    static constexpr std::size_t size = 1;
+
+    T v;
+
+    explicit scalar_pack(T x) : v(x) {}
+
+    static scalar_pack load(const T* p){ return scalar_pack(*p); }
+    void store(T* p) const { *p = v; }
+};
+
+template<typename T>
+inline scalar_pack<T> operator*(scalar_pack<T> a, scalar_pack<T> b){
+    return scalar_pack<T>(a.v * b.v);
+}
+
+using double_pack = scalar_pack<double>;
+using float_pack = scalar_pack<float>;
+
+#endif
+
+template<typename T>
+struct pack;
+
+template<>
+struct pack<double> {
+    using type = double_pack;
+};
+
+template<>
+struct pack<float> {
+    using type = float_pack;
+};
+
+} //end of namespace pow_detail
+
+/*!
+ * \brief Compute out[i] = x[i]^N for len elements, with the chain of ct_pow
+ * applied to SIMD packs.
+ */
+template<std::size_t N, typename T>
+inline void ct_pow_n(const T* x, T* out, std::size_t len){
+    using pack = typename pow_detail::pack<T>::type;
+
+    std::size_t i = 0;
+
+    for(; i + pack::size <= len; i += pack::size){
+        ct_pow<N>(pack::load(x + i)).store(out + i);
+    }
+
+    for(; i < len; ++i){
+        out[i] = ct_pow<N>(x[i]);
+    }
+}
+
+namespace pow_detail {
+
+template<typename T, typename Indices>
+struct pow_n_table;
+
+template<typename T, std::size_t... I>
+struct pow_n_table<T, indices<I...>> {
+    static constexpr void (*table[sizeof...(I)])(const T*, T*, std::size_t) = {&ct_pow_n<I, T>...};
+};
+
+template<typename T, std::size_t... I>
+constexpr void (*pow_n_table<T, indices<I...>>::table[sizeof...(I)])(const T*, T*, std::size_t);
+
+// pow_n for the absolute value of the exponent
+template<typename T>
+inline void pow_n(const T* x, T* out, std::size_t len, unsigned int n){
+    if(n < fast_pow_table_size){
+        pow_n_table<T, typename make_indices<fast_pow_table_size>::type>::table[n](x, out, len);
+        return;
+    }
+
+    using pack = typename pack<T>::type;
+
+    std::size_t i = 0;
+
+    for(; i + pack::size <= len; i += pack::size){
+        pack base = pack::load(x + i);
+        pack r(T(1));
+
+        for(unsigned int m = n; m; m >>= 1){
+            if(m & 1){
+                r = r * base;
+            }
+
+            base = base * base;
+        }
+
+        r.store(out + i);
+    }
+
+    for(; i < len; ++i){
+        out[i] = fast_pow(x[i], n);
+    }
+}
+
+} //end of namespace pow_detail
+
+/*!
+ * \brief Compute out[i] = x[i]^n for len elements.
+ *
+ * The small exponents are dispatched to ct_pow_n through a jump table, the
+ * others use binary exponentiation on SIMD packs. x and out can be the same
+ * array.
+ */
+template<typename T>
+inline void pow_n(const T* x, T* out, std::size_t len, int n){
+    if(n < 0){
+        // -n overflows for INT_MIN, the exponent is negated as unsigned
+        pow_detail::pow_n(x, out, len, 0u - static_cast<unsigned int>(n));
+
+        for(std::size_t i = 0; i < len; ++i){
+            out[i] = T(1) / out[i];
+        }
+
+        return;
+    }
+
+    pow_detail::pow_n(x, out, len, static_cast<unsigned int>(n));
+}
+
+#endif
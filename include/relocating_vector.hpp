@@ -0,0 +1,301 @@
+//=======================================================================
+// Copyright (c) 2014 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#ifndef ARTICLES_RELOCATING_VECTOR
+#define ARTICLES_RELOCATING_VECTOR
+
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+/*!
+ * \brief Traits indicating that an object can be moved to another address
+ * with a memcpy, without calling its move constructor and its destructor.
+ *
+ * Trivially copyable types are always relocatable, other types can
+ * specialize the traits.
+ */
+template<typename T>
+struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+
+/*!
+ * \brief Vector storing trivially relocatable elements with realloc.
+ *
+ * The storage of relocatable types is grown with realloc, which can extend
+ * the block in place and uses mremap for large blocks, and the elements are
+ * shifted with memmove on insertion and erasure. Other types are moved
+ * element by element like in std::vector.
+ */
+template<typename T, bool Relocatable = is_trivially_relocatable<T>::value>
+class relocating_vector {
+    static_assert(alignof(T) <= alignof(std::max_align_t), "relocating_vector only supports the alignment of malloc");
+
+public:
+    using value_type      = T;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference       = T&;
+    using const_reference = const T&;
+    using pointer         = T*;
+    using const_pointer   = const T*;
+    using iterator        = T*;
+    using const_iterator  = const T*;
+
+    relocating_vector() = default;
+
+    relocating_vector(const relocating_vector& rhs){
+        reserve(rhs.size());
+
+        for(auto& value : rhs){
+            push_back(value);
+        }
+    }
+
+    relocating_vector(relocating_vector&& rhs) noexcept : first(rhs.first), last(rhs.last), limit(rhs.limit) {
+        rhs.first = rhs.last = rhs.limit = nullptr;
+    }
+
+    relocating_vector& operator=(const relocating_vector& rhs){
+        if(this != &rhs){
+            clear();
+            reserve(rhs.size());
+
+            for(auto& value : rhs){
+                push_back(value);
+            }
+        }
+
+        return *this;
+    }
+
+    relocating_vector& operator=(relocating_vector&& rhs) noexcept {
+        if(this != &rhs){
+            clear();
+            std::free(first);
+
+            first = rhs.first;
+            last = rhs.last;
+            limit = rhs.limit;
+
+            rhs.first = rhs.last = rhs.limit = nullptr;
+        }
+
+        return *this;
+    }
+
+    ~relocating_vector(){
+        clear();
+        std::free(first);
+    }
+
+    iterator begin(){ return first; }
+    iterator end(){ return last; }
+
+    const_iterator begin() const { return first; }
+    const_iterator end() const { return last; }
+
+    size_type size() const {
+        return last - first;
+    }
+
+    size_type capacity() const {
+        return limit - first;
+    }
+
+    bool empty() const {
+        return first == last;
+    }
+
+    size_type max_size() const {
+        return std::numeric_limits<size_type>::max() / sizeof(T);
+    }
+
+    T& operator[](size_type i){ return first[i]; }
+    const T& operator[](size_type i) const { return first[i]; }
+
+    void reserve(size_type n){
+        if(n > capacity()){
+            reallocate(n);
+        }
+    }
+
+    void shrink_to_fit(){
+        if(last != limit){
+            reallocate(size());
+        }
+    }
+
+    void push_back(const T& value){
+        emplace_back(value);
+    }
+
+    void push_back(T&& value){
+        emplace_back(std::move(value));
+    }
+
+    template<typename... Args>
+    void emplace_back(Args&&... args){
+        if(last == limit){
+            // The value may alias an element that is about to be relocated
+            T value(std::forward<Args>(args)...);
+            grow();
+            ::new (last) T(std::move(value));
+        } else {
+            ::new (last) T(std::forward<Args>(args)...);
+        }
+
+        ++last;
+    }
+
+    iterator insert(const_iterator position, const T& value){
+        return emplace(position, value);
+    }
+
+    iterator insert(const_iterator position, T&& value){
+        return emplace(position, std::move(value));
+    }
+
+    template<typename... Args>
+    iterator emplace(const_iterator position, Args&&... args){
+        size_type index = position - first;
+
+        if(index == size()){
+            emplace_back(std::forward<Args>(args)...);
+            return first + index;
+        }
+
+        T value(std::forward<Args>(args)...);
+
+        if(last == limit){
+            grow();
+        }
+
+        T* target = first + index;
+        open_gap(target, std::integral_constant<bool, Relocatable>());
+        ::new (target) T(std::move(value));
+
+        ++last;
+
+        return target;
+    }
+
+    iterator erase(const_iterator position){
+        T* target = first + (position - first);
+
+        target->~T();
+        close_gap(target, std::integral_constant<bool, Relocatable>());
+
+        --last;
+
+        return target;
+    }
+
+    void pop_back(){
+        (--last)->~T();
+    }
+
+    void clear(){
+        for(T* it = first; it != last; ++it){
+            it->~T();
+        }
+
+        last = first;
+    }
+
+private:
+    T* first = nullptr;
+    T* last = nullptr;
+    T* limit = nullptr;
+
+    void grow(){
+        size_type current = capacity();
+        reallocate(current ? 2 * current : 16);
+    }
+
+    void reallocate(size_type n){
+        // n * sizeof(T) must not overflow
+        if(n > max_size()){
+            throw std::length_error("relocating_vector: too many elements");
+        }
+
+        size_type count = size();
+        T* storage = allocate(n, std::integral_constant<bool, Relocatable>());
+
+        first = storage;
+        last = storage + count;
+        limit = storage + n;
+    }
+
+    // The elements are relocated by realloc, in place if possible
+    T* allocate(size_type n, std::true_type){
+        void* storage = std::realloc(static_cast<void*>(first), n * sizeof(T));
+
+        if(!storage && n){
+            throw std::bad_alloc();
+        }
+
+        return static_cast<T*>(storage);
+    }
+
+    T* allocate(size_type n, std::false_type){
+        T* storage = static_cast<T*>(std::malloc(n * sizeof(T)));
+
+        if(!storage && n){
+            throw std::bad_alloc();
+        }
+
+        for(size_type i = 0; i < size(); ++i){
+            ::new (storage + i) T(std::move_if_noexcept(first[i]));
+            first[i].~T();
+        }
+
+        std::free(first);
+
+        return storage;
+    }
+
+    // Make room for one element at target, the storage must not be full
+    void open_gap(T* target, std::true_type){
+        std::memmove(static_cast<void*>(target + 1), static_cast<void*>(target), (last - target) * sizeof(T));
+    }
+
+    void open_gap(T* target, std::false_type){
+        ::new (last) T(std::move(*(last - 1)));
+
+        for(T* it = last - 1; it != target; --it){
+            *it = std::move(*(it - 1));
+        }
+
+        target->~T();
+    }
+
+    // Fill the hole left by the destroyed element at target
+    void close_gap(T* target, std::true_type){
+        std::memmove(static_cast<void*>(target), static_cast<void*>(target + 1), (last - target - 1) * sizeof(T));
+    }
+
+    void close_gap(T* target, std::false_type){
+        if(target + 1 == last){
+            return;
+        }
+
+        ::new (target) T(std::move(*(target + 1)));
+
+        for(T* it = target + 1; it != last - 1; ++it){
+            *it = std::move(*(it + 1));
+        }
+
+        (last - 1)->~T();
+    }
+};
+
+#endif
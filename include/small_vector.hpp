@@ -0,0 +1,205 @@
+//=======================================================================
+// Copyright (c) 2014 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#ifndef ARTICLES_SMALL_VECTOR
+#define ARTICLES_SMALL_VECTOR
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/*!
+ * \brief Vector storing up to N elements inside the object itself.
+ *
+ * No memory is allocated until the size exceeds N, the elements are then
+ * moved to the heap and the container behaves like std::vector.
+ */
+template<typename T, std::size_t N = 16>
+class small_vector {
+    static_assert(N > 0, "small_vector needs an inline capacity");
+
+public:
+    using value_type      = T;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference       = T&;
+    using const_reference = const T&;
+    using pointer         = T*;
+    using const_pointer   = const T*;
+    using iterator        = T*;
+    using const_iterator  = const T*;
+
+    small_vector() = default;
+
+    small_vector(const small_vector& rhs){
+        reserve(rhs.size());
+        std::uninitialized_copy(rhs.begin(), rhs.end(), first);
+        elements = rhs.elements;
+    }
+
+    small_vector(small_vector&& rhs) noexcept(std::is_nothrow_move_constructible<T>::value) {
+        steal(rhs);
+    }
+
+    small_vector& operator=(const small_vector& rhs){
+        if(this != &rhs){
+            clear();
+            reserve(rhs.size());
+            std::uninitialized_copy(rhs.begin(), rhs.end(), first);
+            elements = rhs.elements;
+        }
+
+        return *this;
+    }
+
+    small_vector& operator=(small_vector&& rhs) noexcept(std::is_nothrow_move_constructible<T>::value) {
+        if(this != &rhs){
+            clear();
+            release();
+            steal(rhs);
+        }
+
+        return *this;
+    }
+
+    ~small_vector(){
+        clear();
+        release();
+    }
+
+    iterator begin(){ return first; }
+    iterator end(){ return first + elements; }
+
+    const_iterator begin() const { return first; }
+    const_iterator end() const { return first + elements; }
+
+    size_type size() const {
+        return elements;
+    }
+
+    size_type capacity() const {
+        return limit;
+    }
+
+    bool empty() const {
+        return elements == 0;
+    }
+
+    //! Indicates if the elements are stored inside the object
+    bool is_inline() const {
+        return first == inline_data();
+    }
+
+    T& operator[](size_type i){ return first[i]; }
+    const T& operator[](size_type i) const { return first[i]; }
+
+    T& back(){ return first[elements - 1]; }
+    const T& back() const { return first[elements - 1]; }
+
+    void reserve(size_type n){
+        if(n > limit){
+            reallocate(n);
+        }
+    }
+
+    void push_back(const T& value){
+        emplace_back(value);
+    }
+
+    void push_back(T&& value){
+        emplace_back(std::move(value));
+    }
+
+    template<typename... Args>
+    void emplace_back(Args&&... args){
+        if(elements == limit){
+            // The value may alias an element that is about to be moved
+            T value(std::forward<Args>(args)...);
+            reallocate(2 * limit);
+            ::new (first + elements) T(std::move(value));
+        } else {
+            ::new (first + elements) T(std::forward<Args>(args)...);
+        }
+
+        ++elements;
+    }
+
+    void pop_back(){
+        first[--elements].~T();
+    }
+
+    void clear(){
+        for(size_type i = 0; i < elements; ++i){
+            first[i].~T();
+        }
+
+        elements = 0;
+    }
+
+private:
+    typename std::aligned_storage<sizeof(T) * N, alignof(T)>::type storage;
+
+    T* first = inline_data();
+    size_type elements = 0;
+    size_type limit = N;
+
+    T* inline_data(){
+        return reinterpret_cast<T*>(&storage);
+    }
+
+    const T* inline_data() const {
+        return reinterpret_cast<const T*>(&storage);
+    }
+
+    void reallocate(size_type n){
+        T* heap = static_cast<T*>(::operator new(n * sizeof(T)));
+
+        for(size_type i = 0; i < elements; ++i){
+            ::new (heap + i) T(std::move_if_noexcept(first[i]));
+            first[i].~T();
+        }
+
+        release();
+
+        first = heap;
+        limit = n;
+    }
+
+    // Free the heap storage, if any, the elements must have been destroyed
+    void release(){
+        if(!is_inline()){
+            ::operator delete(first);
+            first = inline_data();
+            limit = N;
+        }
+    }
+
+    // Take the elements of rhs, only moving them if they are inline
+    void steal(small_vector& rhs){
+        if(rhs.is_inline()){
+            for(size_type i = 0; i < rhs.elements; ++i){
+                ::new (first + i) T(std::move(rhs.first[i]));
+            }
+
+            elements = rhs.elements;
+            rhs.clear();
+        } else {
+            first = rhs.first;
+            elements = rhs.elements;
+            limit = rhs.limit;
+
+            rhs.first = rhs.inline_data();
+            rhs.elements = 0;
+            rhs.limit = N;
+        }
+    }
+};
+
+#endif
@@ -0,0 +1,80 @@
+//=======================================================================
+// Copyright (c) 2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#ifndef ARTICLES_TIMER
+#define ARTICLES_TIMER
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <vector>
+
+struct clock_calibration {
+    std::chrono::nanoseconds resolution; ///< Smallest visible difference between two time points
+    std::chrono::nanoseconds overhead;   ///< Duration of an empty measure
+};
+
+namespace timer_detail {
+
+using clock = std::chrono::high_resolution_clock;
+
+inline clock_calibration calibrate(){
+    static constexpr std::size_t samples = 1001;
+
+    std::vector<clock::duration> resolutions;
+    std::vector<clock::duration> overheads;
+
+    for(std::size_t i = 0; i < samples; ++i){
+        clock::time_point t0 = clock::now();
+        clock::time_point t1 = clock::now();
+
+        overheads.push_back(t1 - t0);
+
+        while(t1 == t0){
+            t1 = clock::now();
+        }
+
+        resolutions.push_back(t1 - t0);
+    }
+
+    // The median is not disturbed by the interrupts
+    std::nth_element(overheads.begin(), overheads.begin() + samples / 2, overheads.end());
+
+    clock_calibration calibration;
+    calibration.resolution = std::chrono::duration_cast<std::chrono::nanoseconds>(*std::min_element(resolutions.begin(), resolutions.end()));
+    calibration.overhead = std::chrono::duration_cast<std::chrono::nanoseconds>(overheads[samples / 2]);
+
+    std::cout << "Clock resolution: " << calibration.resolution.count() << "ns, overhead: " << calibration.overhead.count() << "ns" << std::endl;
+
+    return calibration;
+}
+
+} //end of namespace timer_detail
+
+//! The calibration of the clock, measured at the first call
+inline const clock_calibration& calibration(){
+    static const clock_calibration value = timer_detail::calibrate();
+    return value;
+}
+
+/*!
+ * \brief Return the duration between two time points in DurationUnit, without
+ * the overhead of the clock.
+ */
+template<typename DurationUnit>
+inline std::size_t elapsed(std::chrono::high_resolution_clock::time_point t0, std::chrono::high_resolution_clock::time_point t1){
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0) - calibration().overhead;
+
+    if(duration.count() < 0){
+        return 0;
+    }
+
+    return std::chrono::duration_cast<DurationUnit>(duration).count();
+}
+
+#endif
@@ -0,0 +1,509 @@
+//=======================================================================
+// Copyright (c) 2014 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#ifndef ARTICLES_UNROLLED_LIST
+#define ARTICLES_UNROLLED_LIST
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace unrolled_detail {
+
+constexpr std::size_t gcd(std::size_t a, std::size_t b){
+    return b == 0 ? a : gcd(b, a % b);
+}
+
+} //end of namespace unrolled_detail
+
+/*!
+ * \brief Doubly-linked list whose nodes hold a small array of elements.
+ *
+ * The element array of each node is a multiple of the cache line size and
+ * holds around NodeBytes bytes of elements (at least four elements). Middle
+ * insertion only shifts the elements of one node, splitting it when it is
+ * full, iteration walks contiguous arrays and splice is done by relinking
+ * nodes.
+ */
+template<typename T, std::size_t NodeBytes = 512, typename Allocator = std::allocator<T>>
+class unrolled_list {
+    static constexpr std::size_t cache_line = 64;
+
+    // Number of elements needed for the array to be a multiple of the cache line
+    static constexpr std::size_t step = cache_line / unrolled_detail::gcd(cache_line, sizeof(T));
+    static constexpr std::size_t min_capacity = ((4 + step - 1) / step) * step;
+    static constexpr std::size_t fit_capacity = ((NodeBytes / sizeof(T)) / step) * step;
+
+public:
+    static constexpr std::size_t node_capacity = fit_capacity > min_capacity ? fit_capacity : min_capacity;
+
+    using value_type      = T;
+    using allocator_type  = Allocator;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference       = T&;
+    using const_reference = const T&;
+    using pointer         = T*;
+    using const_pointer   = const T*;
+
+private:
+    struct node_base {
+        node_base* prev;
+        node_base* next;
+        std::size_t count;
+    };
+
+    struct node : node_base {
+        typename std::aligned_storage<sizeof(T) * node_capacity, alignof(T)>::type storage;
+
+        T* data(){
+            return reinterpret_cast<T*>(&storage);
+        }
+    };
+
+    using node_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<node>;
+    using node_traits    = std::allocator_traits<node_allocator>;
+
+    template<bool Const>
+    class iterator_impl {
+        node_base* n = nullptr;
+        std::size_t i = 0;
+
+        iterator_impl(node_base* n, std::size_t i) : n(n), i(i) {}
+
+        friend class unrolled_list;
+
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type        = T;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = typename std::conditional<Const, const T*, T*>::type;
+        using reference         = typename std::conditional<Const, const T&, T&>::type;
+
+        iterator_impl() = default;
+
+        // Allow conversion from iterator to const_iterator
+        template<bool C, typename = typename std::enable_if<Const && !C>::type>
+        iterator_impl(const iterator_impl<C>& rhs) : n(rhs.n), i(rhs.i) {}
+
+        reference operator*() const {
+            return static_cast<node*>(n)->data()[i];
+        }
+
+        pointer operator->() const {
+            return &static_cast<node*>(n)->data()[i];
+        }
+
+        iterator_impl& operator++(){
+            if(++i == n->count){
+                n = n->next;
+                i = 0;
+            }
+
+            return *this;
+        }
+
+        iterator_impl operator++(int){
+            iterator_impl copy(*this);
+            ++*this;
+            return copy;
+        }
+
+        iterator_impl& operator--(){
+            if(i == 0){
+                n = n->prev;
+                i = n->count - 1;
+            } else {
+                --i;
+            }
+
+            return *this;
+        }
+
+        iterator_impl operator--(int){
+            iterator_impl copy(*this);
+            --*this;
+            return copy;
+        }
+
+        friend bool operator==(const iterator_impl& lhs, const iterator_impl& rhs){
+            return lhs.n == rhs.n && lhs.i == rhs.i;
+        }
+
+        friend bool operator!=(const iterator_impl& lhs, const iterator_impl& rhs){
+            return !(lhs == rhs);
+        }
+    };
+
+public:
+    using iterator       = iterator_impl<false>;
+    using const_iterator = iterator_impl<true>;
+
+    unrolled_list(){
+        reset();
+    }
+
+    unrolled_list(const unrolled_list& rhs) : unrolled_list() {
+        for(auto& value : rhs){
+            push_back(value);
+        }
+    }
+
+    unrolled_list(unrolled_list&& rhs) : unrolled_list() {
+        steal(rhs);
+    }
+
+    unrolled_list& operator=(const unrolled_list& rhs){
+        if(this != &rhs){
+            clear();
+
+            for(auto& value : rhs){
+                push_back(value);
+            }
+        }
+
+        return *this;
+    }
+
+    unrolled_list& operator=(unrolled_list&& rhs){
+        if(this != &rhs){
+            clear();
+            steal(rhs);
+        }
+
+        return *this;
+    }
+
+    ~unrolled_list(){
+        clear();
+    }
+
+    iterator begin(){ return {head.next, 0}; }
+    iterator end(){ return {&head, 0}; }
+
+    const_iterator begin() const { return {head.next, 0}; }
+    const_iterator end() const { return {const_cast<node_base*>(&head), 0}; }
+
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+
+    size_type size() const {
+        return elements;
+    }
+
+    bool empty() const {
+        return elements == 0;
+    }
+
+    T& front(){ return *begin(); }
+    T& back(){ return *--end(); }
+
+    void push_back(const T& value){
+        emplace_back(value);
+    }
+
+    void push_back(T&& value){
+        emplace_back(std::move(value));
+    }
+
+    void push_front(const T& value){
+        emplace(begin(), value);
+    }
+
+    void push_front(T&& value){
+        emplace(begin(), std::move(value));
+    }
+
+    template<typename... Args>
+    void emplace_back(Args&&... args){
+        node_base* last = head.prev;
+
+        if(last == &head || last->count == node_capacity){
+            last = create_node(last);
+        }
+
+        ::new (data(last) + last->count) T(std::forward<Args>(args)...);
+        ++last->count;
+        ++elements;
+    }
+
+    iterator insert(const_iterator position, const T& value){
+        return emplace(position, value);
+    }
+
+    iterator insert(const_iterator position, T&& value){
+        return emplace(position, std::move(value));
+    }
+
+    template<typename... Args>
+    iterator emplace(const_iterator position, Args&&... args){
+        if(position.n == &head){
+            emplace_back(std::forward<Args>(args)...);
+            return {head.prev, head.prev->count - 1};
+        }
+
+        // The value may alias an element that is about to be shifted
+        T value(std::forward<Args>(args)...);
+
+        node_base* n = position.n;
+        std::size_t i = position.i;
+
+        if(n->count == node_capacity){
+            node_base* m = split(n, node_capacity / 2);
+
+            if(i > n->count){
+                i -= n->count;
+                n = m;
+            }
+        }
+
+        T* values = data(n);
+
+        if(i == n->count){
+            ::new (values + i) T(std::move(value));
+        } else {
+            ::new (values + n->count) T(std::move(values[n->count - 1]));
+            std::move_backward(values + i, values + n->count - 1, values + n->count);
+            values[i] = std::move(value);
+        }
+
+        ++n->count;
+        ++elements;
+
+        return {n, i};
+    }
+
+    iterator erase(const_iterator position){
+        node_base* n = position.n;
+        std::size_t i = position.i;
+
+        T* values = data(n);
+
+        std::move(values + i + 1, values + n->count, values + i);
+        values[n->count - 1].~T();
+        --n->count;
+        --elements;
+
+        if(n->count == 0){
+            node_base* next = n->next;
+            destroy_node(n);
+            return {next, 0};
+        }
+
+        // Merge sparse nodes to keep iteration close to contiguous
+        node_base* next = n->next;
+        if(next != &head && n->count < node_capacity / 2 && n->count + next->count <= node_capacity){
+            merge(n, next);
+        }
+
+        if(i == n->count){
+            return {n->next, 0};
+        }
+
+        return {n, i};
+    }
+
+    iterator erase(const_iterator first, const_iterator last){
+        if(last == end()){
+            truncate(first);
+            return end();
+        }
+
+        auto count = std::distance(first, last);
+
+        iterator it(first.n, first.i);
+        for(decltype(count) i = 0; i < count; ++i){
+            it = erase(it);
+        }
+
+        return it;
+    }
+
+    void pop_back(){
+        erase(--end());
+    }
+
+    void pop_front(){
+        erase(begin());
+    }
+
+    /*!
+     * \brief Move all the elements of other before position. Only the node
+     * containing position may be split, the other nodes are relinked.
+     */
+    void splice(const_iterator position, unrolled_list& other){
+        if(other.empty() || &other == this){
+            return;
+        }
+
+        node_base* n = position.n;
+
+        if(position.i != 0){
+            n = split(n, position.i);
+        }
+
+        node_base* first = other.head.next;
+        node_base* last = other.head.prev;
+
+        first->prev = n->prev;
+        n->prev->next = first;
+        last->next = n;
+        n->prev = last;
+
+        elements += other.elements;
+        other.reset();
+    }
+
+    void clear(){
+        node_base* n = head.next;
+
+        while(n != &head){
+            node_base* next = n->next;
+
+            T* values = data(n);
+            for(std::size_t i = 0; i < n->count; ++i){
+                values[i].~T();
+            }
+
+            free_node(n);
+            n = next;
+        }
+
+        reset();
+    }
+
+private:
+    node_base head;
+    std::size_t elements;
+    node_allocator allocator;
+
+    static T* data(node_base* n){
+        return static_cast<node*>(n)->data();
+    }
+
+    void reset(){
+        head.prev = &head;
+        head.next = &head;
+        head.count = 0;
+        elements = 0;
+    }
+
+    void steal(unrolled_list& rhs){
+        if(!rhs.empty()){
+            head.next = rhs.head.next;
+            head.prev = rhs.head.prev;
+            head.next->prev = &head;
+            head.prev->next = &head;
+            elements = rhs.elements;
+
+            rhs.reset();
+        }
+    }
+
+    // Create an empty node after the given node
+    node_base* create_node(node_base* after){
+        node* n = node_traits::allocate(allocator, 1);
+        ::new (n) node;
+
+        n->count = 0;
+        n->prev = after;
+        n->next = after->next;
+        after->next->prev = n;
+        after->next = n;
+
+        return n;
+    }
+
+    void free_node(node_base* n){
+        node* real = static_cast<node*>(n);
+        real->~node();
+        node_traits::deallocate(allocator, real, 1);
+    }
+
+    // Unlink and free an empty node
+    void destroy_node(node_base* n){
+        n->prev->next = n->next;
+        n->next->prev = n->prev;
+        free_node(n);
+    }
+
+    // Move the elements [at, count) of n into a new node following n
+    node_base* split(node_base* n, std::size_t at){
+        node_base* m = create_node(n);
+
+        T* source = data(n);
+        T* target = data(m);
+
+        for(std::size_t i = at; i < n->count; ++i){
+            ::new (target + (i - at)) T(std::move(source[i]));
+            source[i].~T();
+        }
+
+        m->count = n->count - at;
+        n->count = at;
+
+        return m;
+    }
+
+    // Move all the elements of next at the end of n and free next
+    void merge(node_base* n, node_base* next){
+        T* source = data(next);
+        T* target = data(n);
+
+        for(std::size_t i = 0; i < next->count; ++i){
+            ::new (target + n->count + i) T(std::move(source[i]));
+            source[i].~T();
+        }
+
+        n->count += next->count;
+        destroy_node(next);
+    }
+
+    // Erase all the elements from first to the end
+    void truncate(const_iterator first){
+        if(first.n == &head){
+            return;
+        }
+
+        node_base* n = first.n;
+
+        T* values = data(n);
+        for(std::size_t i = first.i; i < n->count; ++i){
+            values[i].~T();
+        }
+
+        elements -= n->count - first.i;
+        n->count = first.i;
+
+        node_base* next = n->next;
+
+        if(n->count == 0){
+            destroy_node(n);
+        }
+
+        while(next != &head){
+            node_base* following = next->next;
+
+            values = data(next);
+            for(std::size_t i = 0; i < next->count; ++i){
+                values[i].~T();
+            }
+
+            elements -= next->count;
+            destroy_node(next);
+            next = following;
+        }
+    }
+};
+
+template<typename T, std::size_t NodeBytes, typename Allocator>
+constexpr std::size_t unrolled_list<T, NodeBytes, Allocator>::node_capacity;
+
+#endif
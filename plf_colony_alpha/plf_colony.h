@@ -128,6 +128,7 @@
 #include <limits>  // std::numeric_limits
 #include <memory>	// std::uninitialized_copy, std::allocator
 #include <iterator> // std::bidirectional_iterator_tag
+#include <vector> // key_sort buffers
 
 
 #ifdef PLF_COLONY_TYPE_TRAITS_SUPPORT
@@ -138,6 +139,15 @@
 	#include <utility> // std::move
 #endif
 
+// for_each_block scans the skipfield for erased elements with SIMD where available:
+#if defined(__GNUC__) && defined(__AVX2__)
+	#include <immintrin.h> // _mm256_cmpeq_epi8 etc
+	#define PLF_COLONY_AVX2_SUPPORT
+#elif defined(__GNUC__) && defined(__SSE2__)
+	#include <emmintrin.h> // _mm_cmpeq_epi8 etc
+	#define PLF_COLONY_SSE2_SUPPORT
+#endif
+
 #ifdef PLF_COLONY_INITIALIZER_LIST_SUPPORT
 	#include <initializer_list>
 #endif
@@ -3927,15 +3937,40 @@ private:
 	};
 
 
-public:
+	// The sorts of the element pointers used by sort(), timsort() and par_timsort()
+	struct sort_function
+	{
+		template <class iterator_type, class comparison_function>
+		void operator() (iterator_type first, iterator_type last, comparison_function compare) const
+		{
+			std::sort(first, last, compare);
+		}
+	};
 
-	inline void sort()
+	struct timsort_function
 	{
-		sort(less());
-	}
+		template <class iterator_type, class comparison_function>
+		void operator() (iterator_type first, iterator_type last, comparison_function compare) const
+		{
+			plf::timsort(first, last, compare);
+		}
+	};
 
-	template <class comparison_function>
-	void sort(comparison_function compare)
+	#ifdef PLF_TIMSORT_PARALLEL_AVAILABLE
+		struct parallel_timsort_function
+		{
+			template <class iterator_type, class comparison_function>
+			void operator() (iterator_type first, iterator_type last, comparison_function compare) const
+			{
+				plf::parallel_timsort(first, last, compare);
+			}
+		};
+	#endif
+
+
+	// Sort the pointers to the elements with sort_function, then rebuild the colony in their order
+	template <class comparison_function, class sort_function>
+	void sort_by_pointers(comparison_function compare, sort_function sort_pointers)
 	{
 		if (total_number_of_elements < 2)
 		{
@@ -3968,7 +4003,7 @@ public:
 			throw;
 		}
 
-        std::sort(element_pointers, element_pointers + total_number_of_elements, sort_dereferencer<comparison_function>(compare));
+		sort_pointers(element_pointers, element_pointers + total_number_of_elements, sort_dereferencer<comparison_function>(compare));
 
 
 		colony new_location;
@@ -4013,6 +4048,21 @@ public:
 		PLF_COLONY_DEALLOCATE(element_pointer_allocator_type, erased_locations, element_pointers, total_number_of_elements);
 	}
 
+
+
+public:
+
+	inline void sort()
+	{
+		sort(less());
+	}
+
+	template <class comparison_function>
+	void sort(comparison_function compare)
+	{
+		sort_by_pointers(compare, sort_function());
+	}
+
 	inline void timsort()
 	{
 		timsort(less());
@@ -4021,82 +4071,226 @@ public:
 	template <class comparison_function>
 	void timsort(comparison_function compare)
 	{
-		if (total_number_of_elements < 2)
+		sort_by_pointers(compare, timsort_function());
+	}
+
+
+
+	#ifdef PLF_TIMSORT_PARALLEL_AVAILABLE
+	// Same as timsort(), the sort of the element pointers is done on several threads
+	inline void par_timsort()
+	{
+		par_timsort(less());
+	}
+
+	template <class comparison_function>
+	void par_timsort(comparison_function compare)
+	{
+		sort_by_pointers(compare, parallel_timsort_function());
+	}
+
+	#endif
+
+
+
+	#if defined(PLF_COLONY_TYPE_TRAITS_SUPPORT) && defined(PLF_COLONY_MOVE_SEMANTICS_SUPPORT)
+private:
+
+	template <class key_type>
+	struct key_element
+	{
+		key_type key;
+		element_pointer_type element;
+	};
+
+
+	template <class key_type>
+	struct key_element_less
+	{
+		bool operator() (const key_element<key_type> &first, const key_element<key_type> &second) const
 		{
-			return;
+			return first.key < second.key;
 		}
+	};
 
-		element_pointer_type * const element_pointers = PLF_COLONY_ALLOCATE(element_pointer_allocator_type, erased_locations, total_number_of_elements, NULL);
-		element_pointer_type *element_pointer = element_pointers;
 
-		try
+	// LSD radix sort of unsigned integer keys, one byte per pass, skipping the passes where all the keys share the same byte:
+	template <class key_type>
+	static void sort_keys(std::vector<key_element<key_type> > &keys, std::true_type)
+	{
+		std::vector<key_element<key_type> > buffer(keys.size());
+
+		for (unsigned int shift = 0; shift < sizeof(key_type) * 8; shift += 8)
 		{
-			for (iterator current_element = begin_iterator; current_element != end_iterator; ++current_element)
+			size_type counts[256] = {};
+
+			for (size_type current = 0; current != keys.size(); ++current)
 			{
-				PLF_COLONY_CONSTRUCT(element_pointer_allocator_type, erased_locations, element_pointer++, &*current_element);
+				++counts[(keys[current].key >> shift) & 0xFF];
 			}
-		}
-		catch (...)
-		{
-			#ifdef PLF_COLONY_TYPE_TRAITS_SUPPORT
-				if (!std::is_trivially_destructible<element_pointer_type>::value)
-			#endif
+
+			if (counts[(keys[0].key >> shift) & 0xFF] == keys.size())
 			{
-				for(element_pointer_type *current_element_pointer = element_pointers; current_element_pointer != element_pointer; ++current_element_pointer)
-				{
-					PLF_COLONY_DESTROY(element_pointer_allocator_type, erased_locations, current_element_pointer);
-				}
+				continue;
 			}
 
-			PLF_COLONY_DEALLOCATE(element_pointer_allocator_type, erased_locations, element_pointers, total_number_of_elements);
-			throw;
+			size_type offset = 0;
+
+			for (unsigned int bucket = 0; bucket != 256; ++bucket)
+			{
+				const size_type count = counts[bucket];
+				counts[bucket] = offset;
+				offset += count;
+			}
+
+			for (size_type current = 0; current != keys.size(); ++current)
+			{
+				buffer[counts[(keys[current].key >> shift) & 0xFF]++] = keys[current];
+			}
+
+			keys.swap(buffer);
 		}
+	}
 
-        plf::timsort(element_pointers, element_pointers + total_number_of_elements, sort_dereferencer<comparison_function>(compare));
 
+	template <class key_type>
+	static void sort_keys(std::vector<key_element<key_type> > &keys, std::false_type)
+	{
+		std::stable_sort(keys.begin(), keys.end(), key_element_less<key_type>());
+	}
 
-		colony new_location;
-		new_location.change_group_sizes(min_elements_per_group, group_allocator_pair.max_elements_per_group);
-		new_location.reserve(static_cast<skipfield_type>((total_number_of_elements > std::numeric_limits<skipfield_type>::max()) ? std::numeric_limits<skipfield_type>::max() : total_number_of_elements));
 
-		#if defined(PLF_COLONY_TYPE_TRAITS_SUPPORT) && defined(PLF_COLONY_MOVE_SEMANTICS_SUPPORT)
-			if (std::is_move_assignable<element_type>::value)
+public:
+
+	// Stable sort on the key returned by get_key for each element. The comparisons are done on a contiguous buffer of (key, element pointer) pairs instead of
+	// through the element pointers, the pairs being radix sorted for unsigned integer keys. The elements are then gathered in order into a buffer and moved back.
+	// Gathering is much faster than following the cycles of the permutation in place, where each cache miss has to wait for the previous one.
+	template <class key_function>
+	void key_sort(key_function get_key)
+	{
+		typedef typename std::decay<decltype(get_key(*begin_iterator))>::type key_type;
+
+		if (total_number_of_elements < 2)
+		{
+			return;
+		}
+
+		std::vector<key_element<key_type> > keys;
+		keys.reserve(total_number_of_elements);
+
+		for (iterator current_element = begin_iterator; current_element != end_iterator; ++current_element)
+		{
+			const key_element<key_type> current_key = {get_key(*current_element), &*current_element};
+			keys.push_back(current_key);
+		}
+
+		sort_keys(keys, std::integral_constant<bool, std::is_integral<key_type>::value && std::is_unsigned<key_type>::value>());
+
+		std::vector<element_type> sorted_elements;
+		sorted_elements.reserve(total_number_of_elements);
+
+		for (size_type current = 0; current != total_number_of_elements; ++current)
+		{
+			sorted_elements.push_back(std::move(*keys[current].element));
+		}
+
+		typename std::vector<element_type>::iterator sorted_element = sorted_elements.begin();
+
+		for (iterator current_element = begin_iterator; current_element != end_iterator; ++current_element, ++sorted_element)
+		{
+			*current_element = std::move(*sorted_element);
+		}
+	}
+	#endif
+
+
+
+private:
+
+	// Returns the first non-zero (ie. erased) skipfield node in [current, last), or last. The nodes are compared to zero byte by byte, which works for any skipfield type:
+	static const skipfield_type * find_erased(const skipfield_type *current, const skipfield_type * const last)
+	{
+		#if defined(PLF_COLONY_AVX2_SUPPORT)
+			const __m256i zero = _mm256_setzero_si256();
+
+			while (last - current >= static_cast<std::ptrdiff_t>(32 / sizeof(skipfield_type)))
 			{
-				for(element_pointer_type *current_element_pointer = element_pointers; current_element_pointer != element_pointer; ++current_element_pointer)
+				const unsigned int zero_bytes = static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(current)), zero)));
+
+				if (zero_bytes != 0xFFFFFFFFu)
 				{
-					new_location.insert(std::move(*(*current_element_pointer)));
+					return current + (__builtin_ctz(~zero_bytes) / sizeof(skipfield_type));
 				}
+
+				current += 32 / sizeof(skipfield_type);
 			}
-			else
-		#endif
-		{
-			for(element_pointer_type *current_element_pointer = element_pointers; current_element_pointer != element_pointer; ++current_element_pointer)
+		#elif defined(PLF_COLONY_SSE2_SUPPORT)
+			const __m128i zero = _mm_setzero_si128();
+
+			while (last - current >= static_cast<std::ptrdiff_t>(16 / sizeof(skipfield_type)))
 			{
-				new_location.insert(*(*current_element_pointer));
+				const unsigned int zero_bytes = static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(current)), zero)));
+
+				if (zero_bytes != 0xFFFFu)
+				{
+					return current + (__builtin_ctz(~zero_bytes) / sizeof(skipfield_type));
+				}
+
+				current += 16 / sizeof(skipfield_type);
 			}
+		#endif
+
+		while (current != last && *current == 0)
+		{
+			++current;
 		}
 
+		return current;
+	}
 
-		#ifdef PLF_COLONY_MOVE_SEMANTICS_SUPPORT
-			*this = std::move(new_location); // avoid generating temporary
-		#else
-			swap(new_location);
-		#endif
 
+public:
 
-		#ifdef PLF_COLONY_TYPE_TRAITS_SUPPORT
-			if (!std::is_trivially_destructible<element_pointer_type>::value)
-		#endif
+	// Calls function(first, last) for each contiguous run [first, last) of non-erased elements, in iteration order. Unlike iterator ++, the elements of a run are visited without
+	// reading the skipfield, so the function can be vectorized. The end of a run is found by scanning the skipfield, the next run by jumping over the erased block.
+	template <class block_function>
+	void for_each_block(block_function function)
+	{
+		if (total_number_of_elements == 0)
 		{
-			for(element_pointer_type *current_element_pointer = element_pointers; current_element_pointer != element_pointer; ++current_element_pointer)
+			return;
+		}
+
+		for (group_pointer_type current_group = begin_iterator.group_pointer; current_group != NULL; current_group = current_group->next_group)
+		{
+			element_type * const elements = &*(current_group->elements);
+			const size_type used = static_cast<size_type>(current_group->last_endpoint - current_group->elements);
+
+			if (current_group->number_of_elements == used) // no erasures in this group
 			{
-				PLF_COLONY_DESTROY(element_pointer_allocator_type, erased_locations, current_element_pointer);
+				function(elements, elements + used);
+				continue;
 			}
-		}
 
-		PLF_COLONY_DEALLOCATE(element_pointer_allocator_type, erased_locations, element_pointers, total_number_of_elements);
-	}
+			const skipfield_type * const skipfield_start = &*(current_group->skipfield);
+			const skipfield_type * const skipfield_end = skipfield_start + used;
+			const skipfield_type *current = skipfield_start;
+
+			while (current != skipfield_end)
+			{
+				current += *current; // the first node of an erased block holds the length of the block
+
+				const skipfield_type * const block_end = find_erased(current, skipfield_end);
+
+				if (block_end != current)
+				{
+					function(elements + (current - skipfield_start), elements + (block_end - skipfield_start));
+				}
 
+				current = block_end;
+			}
+		}
+	}
 
 };	// colony
 
@@ -39,6 +39,16 @@
 #include <algorithm> // std::copy
 
 
+// The parallel timsort needs the C++11 threads:
+#if (defined(_MSC_VER) && _MSC_VER >= 1700) || (defined(__cplusplus) && __cplusplus >= 201103L)
+	#include <atomic>
+	#include <thread>
+	#include <iterator> // std::move_iterator
+
+	#define PLF_TIMSORT_PARALLEL_AVAILABLE
+#endif
+
+
 // If compiler supports both type traits and move semantics - will cover most but not all compilers/std libraries:
 #if (defined(_MSC_VER) && _MSC_VER >= 1700) || ((defined(__cplusplus) && __cplusplus >= 201103L) && ((!defined(__GNUC__) || __GNUC__ >= 5)) && (!defined(__GLIBCXX__) || __GLIBCXX__ >= 20150422))
 	#include <iterator> // iterator_traits
@@ -92,6 +102,28 @@ inline void timsort(RandomAccessIterator const first, RandomAccessIterator const
 template <typename RandomAccessIterator, typename LessFunction>
 inline void timsort(RandomAccessIterator const first, RandomAccessIterator const last, LessFunction compare);
 
+#ifdef PLF_TIMSORT_PARALLEL_AVAILABLE
+
+/**
+ * Same as std::stable_sort(first, last), using all the hardware threads.
+ */
+template <typename RandomAccessIterator>
+inline void parallel_timsort(RandomAccessIterator const first, RandomAccessIterator const last);
+
+/**
+ * Same as std::stable_sort(first, last, c), using all the hardware threads.
+ */
+template <typename RandomAccessIterator, typename LessFunction>
+inline void parallel_timsort(RandomAccessIterator const first, RandomAccessIterator const last, LessFunction compare);
+
+/**
+ * Same as std::stable_sort(first, last, c), using the given number of threads.
+ */
+template <typename RandomAccessIterator, typename LessFunction>
+inline void parallel_timsort(RandomAccessIterator const first, RandomAccessIterator const last, LessFunction compare, unsigned int threads);
+
+#endif
+
 
 
 
@@ -842,6 +874,215 @@ inline void timsort(RandomAccessIterator const first, RandomAccessIterator const
 }
 
 
+
+
+#ifdef PLF_TIMSORT_PARALLEL_AVAILABLE
+
+// Each thread timsorts a chunk of the range, detecting the natural runs of its chunk, then the sorted chunks are
+// merged pairwise. Each merge is split into segments of the output with merge-path partitioning, the segments being
+// merged in parallel into a buffer and moved back. Pairs of chunks already in order are not merged at all.
+template <typename RandomAccessIterator, typename LessFunction> class ParallelTimSort
+{
+	typedef RandomAccessIterator iter_t;
+	typedef typename std::iterator_traits<iter_t>::value_type value_t;
+	typedef typename std::iterator_traits<iter_t>::difference_type diff_t;
+
+	static const diff_t MIN_SEGMENT = 4096;
+
+	struct merge_job
+	{
+		diff_t first, middle, last; // the two sorted runs [first, middle) and [middle, last)
+		diff_t begin, end; // the part of the merged output done by this job, relative to first
+		diff_t a_begin, a_end; // the part of the first run merged by this job, relative to first
+
+		merge_job(diff_t const f, diff_t const m, diff_t const l, diff_t const b, diff_t const e) : first(f), middle(m), last(l), begin(b), end(e), a_begin(0), a_end(0) {}
+	};
+
+
+	// Run function(0) to function(job_count - 1) on the given number of threads
+	template <typename Function>
+	static void run_jobs(std::size_t const job_count, unsigned int const threads, Function function)
+	{
+		std::atomic<std::size_t> next_job(0);
+
+		auto worker = [&]()
+		{
+			for (std::size_t job = next_job++; job < job_count; job = next_job++)
+			{
+				function(job);
+			}
+		};
+
+		std::vector<std::thread> pool;
+
+		for (unsigned int thread = 1; thread < threads && thread < job_count; ++thread)
+		{
+			pool.push_back(std::thread(worker));
+		}
+
+		worker();
+
+		for (std::size_t thread = 0; thread != pool.size(); ++thread)
+		{
+			pool[thread].join();
+		}
+	}
+
+
+	// Number of elements of the first run among the first diagonal elements of the stable merge of the two runs
+	static diff_t merge_path(iter_t const a, diff_t const a_length, iter_t const b, diff_t const b_length, diff_t const diagonal, LessFunction &compare)
+	{
+		diff_t low = (diagonal > b_length) ? diagonal - b_length : 0;
+		diff_t high = (diagonal < a_length) ? diagonal : a_length;
+
+		while (low < high)
+		{
+			diff_t const middle = low + (high - low) / 2;
+
+			if (compare(*(b + (diagonal - middle - 1)), *(a + middle)))
+			{
+				high = middle;
+			}
+			else
+			{
+				low = middle + 1;
+			}
+		}
+
+		return low;
+	}
+
+
+	static void sort(iter_t const first, iter_t const last, LessFunction compare, unsigned int threads)
+	{
+		diff_t const length = last - first;
+
+		if (threads < 2 || length < 2 * MIN_SEGMENT)
+		{
+			timsort(first, last, compare);
+			return;
+		}
+
+		if (static_cast<diff_t>(threads) > length / MIN_SEGMENT)
+		{
+			threads = static_cast<unsigned int>(length / MIN_SEGMENT);
+		}
+
+		std::vector<diff_t> bounds;
+
+		for (unsigned int chunk = 0; chunk <= threads; ++chunk)
+		{
+			bounds.push_back(length * chunk / threads);
+		}
+
+		run_jobs(threads, threads, [&](std::size_t const chunk)
+		{
+			timsort(first + bounds[chunk], first + bounds[chunk + 1], compare);
+		});
+
+		std::vector<value_t> buffer(length);
+		diff_t const segment = length / threads;
+
+		while (bounds.size() > 2)
+		{
+			std::vector<diff_t> next_bounds;
+			std::vector<merge_job> jobs;
+
+			std::size_t const runs = bounds.size() - 1;
+
+			for (std::size_t run = 0; run < runs; run += 2)
+			{
+				next_bounds.push_back(bounds[run]);
+
+				if (run + 1 == runs) // odd run out, stays in place
+				{
+					break;
+				}
+
+				diff_t const run_first = bounds[run], run_middle = bounds[run + 1], run_last = bounds[run + 2];
+
+				if (!compare(*(first + run_middle), *(first + (run_middle - 1)))) // already in order
+				{
+					continue;
+				}
+
+				for (diff_t begin = 0; begin < run_last - run_first; begin += segment)
+				{
+					diff_t const end = (begin + segment < run_last - run_first) ? begin + segment : run_last - run_first;
+					jobs.push_back(merge_job(run_first, run_middle, run_last, begin, end));
+				}
+			}
+
+			next_bounds.push_back(length);
+
+			// The split points must all be found before any element is moved out of the runs
+			run_jobs(jobs.size(), threads, [&](std::size_t const j)
+			{
+				merge_job &job = jobs[j];
+
+				iter_t const a = first + job.first, b = first + job.middle;
+				diff_t const a_length = job.middle - job.first, b_length = job.last - job.middle;
+
+				job.a_begin = merge_path(a, a_length, b, b_length, job.begin, compare);
+				job.a_end = merge_path(a, a_length, b, b_length, job.end, compare);
+			});
+
+			run_jobs(jobs.size(), threads, [&](std::size_t const j)
+			{
+				merge_job const &job = jobs[j];
+
+				iter_t const a = first + job.first, b = first + job.middle;
+
+				std::merge(std::make_move_iterator(a + job.a_begin), std::make_move_iterator(a + job.a_end),
+					std::make_move_iterator(b + (job.begin - job.a_begin)), std::make_move_iterator(b + (job.end - job.a_end)),
+					buffer.begin() + (job.first + job.begin), compare);
+			});
+
+			// The segments can only be moved back once all the merges of this pass are done
+			run_jobs(jobs.size(), threads, [&](std::size_t const j)
+			{
+				merge_job const &job = jobs[j];
+				std::move(buffer.begin() + (job.first + job.begin), buffer.begin() + (job.first + job.end), first + (job.first + job.begin));
+			});
+
+			bounds.swap(next_bounds);
+		}
+	}
+
+
+	// the only interface is the friend parallel_timsort() function
+	template <typename IterT, typename LessT> friend void parallel_timsort(IterT first, IterT last, LessT c, unsigned int threads);
+};
+
+
+
+template <typename RandomAccessIterator>
+inline void parallel_timsort(RandomAccessIterator const first, RandomAccessIterator const last)
+{
+	typedef typename std::iterator_traits<RandomAccessIterator>::value_type value_type;
+	parallel_timsort(first, last, std::less<value_type>());
+}
+
+
+
+template <typename RandomAccessIterator, typename LessFunction>
+inline void parallel_timsort(RandomAccessIterator const first, RandomAccessIterator const last, LessFunction compare)
+{
+	unsigned int const threads = std::thread::hardware_concurrency();
+	parallel_timsort(first, last, compare, (threads == 0) ? 1 : threads);
+}
+
+
+
+template <typename RandomAccessIterator, typename LessFunction>
+inline void parallel_timsort(RandomAccessIterator const first, RandomAccessIterator const last, LessFunction compare, unsigned int threads)
+{
+	ParallelTimSort<RandomAccessIterator, LessFunction>::sort(first, last, compare, threads);
+}
+
+#endif
+
+
 } // namespace plf
 
 
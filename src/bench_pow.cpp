@@ -0,0 +1,131 @@
+//=======================================================================
+// Copyright (c) 2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#include <chrono>
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "barrier.hpp"
+#include "graphs.hpp"
+#include "pow.hpp"
+#include "timer.hpp"
+
+using timer = std::chrono::high_resolution_clock;
+using nanoseconds = std::chrono::nanoseconds;
+
+// x * x * ... * x with N - 1 multiplications
+template<std::size_t N>
+struct product {
+    template<typename T>
+    static T compute(T x){
+        return x * product<N - 1>::compute(x);
+    }
+};
+
+template<>
+struct product<1> {
+    template<typename T>
+    static T compute(T x){
+        return x;
+    }
+};
+
+// Time the computation of functor(x) for x in [0, iterations[
+template<typename T, typename Functor>
+std::size_t measure(std::size_t iterations, Functor functor){
+    timer::time_point t0 = timer::now();
+
+    for(std::size_t i = 0; i < iterations; ++i){
+        T result = functor(T(i));
+        do_not_optimize(result);
+    }
+
+    timer::time_point t1 = timer::now();
+
+    return elapsed<nanoseconds>(t0, t1);
+}
+
+/*!
+ * \brief Implementations of x^Exp for the small exponents, the multiplications
+ * are written by hand in the loop
+ */
+template<typename T, std::size_t Exp>
+void bench_small_exponent(const std::string& type, const std::vector<std::size_t>& iterations){
+    for(auto it : iterations){
+        auto group = std::to_string(it);
+
+        graphs::new_result(type + " pow", group, measure<T>(it, [](T x){ return pow(x, int(Exp)); }));
+        graphs::new_result(type + " std::pow", group, measure<T>(it, [](T x){ return std::pow(x, int(Exp)); }));
+        graphs::new_result(type + " x * x", group, measure<T>(it, [](T x){ return product<Exp>::compute(x); }));
+        graphs::new_result(type + " ct_pow", group, measure<T>(it, [](T x){ return ct_pow<Exp>(x); }));
+    }
+}
+
+template<typename... T>
+void bench_small_exponents(const std::vector<std::size_t>&){
+    //End of recursion
+}
+
+// One graph per exponent, with the float and double curves
+template<std::size_t Exp, std::size_t... Exps>
+void bench_small_exponents(const std::vector<std::size_t>& iterations){
+    graphs::new_graph("pow_" + std::to_string(Exp), "x^" + std::to_string(Exp), "ns");
+
+    bench_small_exponent<float, Exp>("float", iterations);
+    bench_small_exponent<double, Exp>("double", iterations);
+
+    bench_small_exponents<Exps...>(iterations);
+}
+
+/*!
+ * \brief Implementations of x^Exp for the large exponents, for which the
+ * multiplications cannot be written by hand
+ */
+template<typename T, std::size_t Exp>
+void bench_large_exponent(const std::string& type, std::size_t iterations){
+    auto group = std::to_string(Exp);
+
+    graphs::new_result(type + " pow", group, measure<T>(iterations, [](T x){ return pow(x, int(Exp)); }));
+    graphs::new_result(type + " std::pow", group, measure<T>(iterations, [](T x){ return std::pow(x, int(Exp)); }));
+    graphs::new_result(type + " my_pow", group, measure<T>(iterations, [](T x){ return my_pow(x, Exp); }));
+    graphs::new_result(type + " second_pow", group, measure<T>(iterations, [](T x){ return second_pow(x, Exp); }));
+    graphs::new_result(type + " third_pow", group, measure<T>(iterations, [](T x){ return third_pow(x, Exp); }));
+    graphs::new_result(type + " ct_pow", group, measure<T>(iterations, [](T x){ return ct_pow<Exp>(x); }));
+    graphs::new_result(type + " fast_pow", group, measure<T>(iterations, [](T x){ return fast_pow(x, Exp); }));
+}
+
+template<typename T>
+void bench_large_exponents(const std::string&, std::size_t){
+    //End of recursion
+}
+
+template<typename T, std::size_t Exp, std::size_t... Exps>
+void bench_large_exponents(const std::string& type, std::size_t iterations){
+    bench_large_exponent<T, Exp>(type, iterations);
+    bench_large_exponents<T, Exps...>(type, iterations);
+}
+
+template<typename T>
+void bench_large_exponents(const std::string& type){
+    bench_large_exponents<T,
+        1, 5, 10, 20, 30, 40, 50, 60, 70, 80, 90, 100, 110, 120, 130, 140, 150,
+        160, 170, 180, 190, 200, 300, 400, 500, 600, 700, 800, 900, 1000>(type, 5000);
+}
+
+int main(){
+    bench_small_exponents<2, 3, 4, 5>({100, 1000, 10000, 100000, 1000000, 10000000});
+
+    graphs::new_graph("pow_large", "x^n for 5000 values", "ns");
+
+    bench_large_exponents<float>("float");
+    bench_large_exponents<double>("double");
+
+    graphs::output(graphs::Output::GOOGLE);
+
+    return 0;
+}
@@ -0,0 +1,189 @@
+//=======================================================================
+// Copyright (c) 2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#include <algorithm>
+#include <iostream>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "barrier.hpp"
+#include "graphs.hpp"
+#include "pow.hpp"
+#include "timer.hpp"
+
+using timer = std::chrono::high_resolution_clock;
+using microseconds =  std::chrono::microseconds;
+
+// Number of inputs drawn in each range
+static constexpr size_t inputs = 100000;
+
+// Map a double to an integer so that consecutive doubles are consecutive integers
+int64_t ordered(double x){
+    int64_t bits;
+    std::memcpy(&bits, &x, sizeof(bits));
+    return bits < 0 ? std::numeric_limits<int64_t>::min() - bits : bits;
+}
+
+uint64_t ulp_distance(double a, double b){
+    if(a == b){
+        return 0;
+    }
+
+    if(std::isnan(a) || std::isnan(b)){
+        return std::numeric_limits<uint64_t>::max();
+    }
+
+    int64_t x = ordered(a);
+    int64_t y = ordered(b);
+
+    return x < y ? uint64_t(y) - uint64_t(x) : uint64_t(x) - uint64_t(y);
+}
+
+struct input_range {
+    std::string name;
+    double min;
+    double max;
+};
+
+struct accuracy {
+    uint64_t max_ulp = 0;
+    double mean_ulp = 0;
+    size_t us = 0;
+};
+
+/*!
+ * \brief Time the implementation on all the inputs and compare its results
+ * with the powers computed in long double and rounded to double.
+ */
+template<typename Functor>
+accuracy measure(const std::vector<double>& x, const std::vector<double>& reference, size_t n, Functor functor){
+    std::vector<double> out(x.size());
+
+    do_not_optimize(out.data());
+
+    timer::time_point t0 = timer::now();
+
+    for(size_t i = 0; i < x.size(); ++i){
+        out[i] = functor(x[i], n);
+    }
+
+    clobber_memory();
+
+    timer::time_point t1 = timer::now();
+
+    accuracy result;
+    result.us = elapsed<microseconds>(t0, t1);
+
+    double sum = 0;
+
+    for(size_t i = 0; i < x.size(); ++i){
+        auto ulp = ulp_distance(out[i], reference[i]);
+
+        result.max_ulp = std::max(result.max_ulp, ulp);
+        sum += double(ulp);
+    }
+
+    result.mean_ulp = sum / x.size();
+
+    return result;
+}
+
+// The functor is kept with its own type so that its call is inlined in measure
+template<typename Functor>
+struct implementation {
+    std::string name;
+    Functor pow;
+};
+
+template<typename Functor>
+implementation<Functor> make_implementation(const std::string& name, Functor pow){
+    return {name, pow};
+}
+
+template<typename... Functors>
+void bench_accuracy(const input_range& range, const implementation<Functors>&... implementations){
+    std::vector<std::string> names{implementations.name...};
+
+    std::mt19937_64 generator;
+    std::uniform_real_distribution<double> distribution(range.min, range.max);
+
+    std::vector<double> x(inputs);
+
+    for(auto& v : x){
+        v = distribution(generator);
+    }
+
+    std::vector<size_t> exponents{2, 5, 10, 20, 50, 100, 200};
+
+    // One graph per measure, all sharing the exponents as x axis
+    std::vector<std::vector<accuracy>> results(exponents.size());
+
+    for(size_t e = 0; e < exponents.size(); ++e){
+        auto n = exponents[e];
+
+        std::vector<double> reference(x.size());
+
+        for(size_t i = 0; i < x.size(); ++i){
+            reference[i] = double(std::pow(static_cast<long double>(x[i]), int(n)));
+        }
+
+        // The elements of a braced list are evaluated in order
+        results[e] = {measure(x, reference, n, implementations.pow)...};
+
+        for(size_t i = 0; i < names.size(); ++i){
+            auto& result = results[e][i];
+
+            std::cout << range.name << " " << names[i] << "(x, " << n << "): "
+                << result.max_ulp << " max ULP, " << result.mean_ulp << " mean ULP, " << result.us << "us" << std::endl;
+        }
+    }
+
+    auto title_range = " in [" + std::to_string(range.min) + ", " + std::to_string(range.max) + "]";
+
+    graphs::new_graph("pow_max_ulp_" + range.name, "pow max error" + title_range, "ULP");
+    for(size_t e = 0; e < exponents.size(); ++e){
+        for(size_t i = 0; i < names.size(); ++i){
+            graphs::new_result(names[i], std::to_string(exponents[e]), results[e][i].max_ulp);
+        }
+    }
+
+    graphs::new_graph("pow_mean_ulp_" + range.name, "pow mean error" + title_range, "1/100 ULP");
+    for(size_t e = 0; e < exponents.size(); ++e){
+        for(size_t i = 0; i < names.size(); ++i){
+            graphs::new_result(names[i], std::to_string(exponents[e]), size_t(results[e][i].mean_ulp * 100));
+        }
+    }
+
+    graphs::new_graph("pow_time_" + range.name, "pow time" + title_range, "us");
+    for(size_t e = 0; e < exponents.size(); ++e){
+        for(size_t i = 0; i < names.size(); ++i){
+            graphs::new_result(names[i], std::to_string(exponents[e]), results[e][i].us);
+        }
+    }
+}
+
+int main(){
+    auto my         = make_implementation("my_pow", [](double x, size_t n){ return my_pow(x, n); });
+    auto second     = make_implementation("second_pow", [](double x, size_t n){ return second_pow(x, n); });
+    auto third      = make_implementation("third_pow", [](double x, size_t n){ return third_pow(x, n); });
+    auto fast       = make_implementation("fast_pow", [](double x, size_t n){ return fast_pow(x, n); });
+    auto std_pow    = make_implementation("std_pow", [](double x, size_t n){ return std::pow(x, int(n)); });
+
+    bench_accuracy({"narrow", 0.9, 1.1}, my, second, third, fast, std_pow);
+    bench_accuracy({"unit", 0.5, 2.0}, my, second, third, fast, std_pow);
+    bench_accuracy({"wide", 1.0, 10.0}, my, second, third, fast, std_pow);
+
+    graphs::output(graphs::Output::GOOGLE);
+
+    return 0;
+}
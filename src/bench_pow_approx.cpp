@@ -0,0 +1,164 @@
+//=======================================================================
+// Copyright (c) 2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#include <algorithm>
+#include <iostream>
+#include <chrono>
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "approx_pow.hpp"
+#include "barrier.hpp"
+#include "timer.hpp"
+
+using timer = std::chrono::high_resolution_clock;
+using microseconds =  std::chrono::microseconds;
+
+std::string precision_name(pow_precision precision){
+    switch(precision){
+        case pow_precision::low:
+            return "low";
+        case pow_precision::medium:
+            return "medium";
+        default:
+            return "high";
+    }
+}
+
+template<typename T, size_t It>
+void bench_c_pow(T y){
+    timer::time_point t0 = timer::now();
+
+    for(size_t i = 0; i < It; ++i){
+        T result = pow(T(i + 1), y);
+        do_not_optimize(result);
+    }
+
+    timer::time_point t1 = timer::now();
+    auto us = elapsed<microseconds>(t0, t1);
+
+    std::cout << "pow(x, " << y << ") [" << It << "]: " << us << "us" << std::endl;
+}
+
+template<typename T, size_t It>
+void bench_std_pow(T y){
+    timer::time_point t0 = timer::now();
+
+    for(size_t i = 0; i < It; ++i){
+        T result = std::pow(T(i + 1), y);
+        do_not_optimize(result);
+    }
+
+    timer::time_point t1 = timer::now();
+    auto us = elapsed<microseconds>(t0, t1);
+
+    std::cout << "std::pow(x, " << y << ") [" << It << "]: " << us << "us" << std::endl;
+}
+
+template<typename T, size_t It, pow_precision P>
+void bench_approx_pow(T y){
+    timer::time_point t0 = timer::now();
+
+    for(size_t i = 0; i < It; ++i){
+        T result = approx_pow<P>(T(i + 1), y);
+        do_not_optimize(result);
+    }
+
+    timer::time_point t1 = timer::now();
+    auto us = elapsed<microseconds>(t0, t1);
+
+    std::cout << "approx_pow<" << precision_name(P) << ">(x, " << y << ") [" << It << "]: " << us << "us" << std::endl;
+}
+
+template<typename T, size_t It>
+void bench_std_pow_array(T y){
+    std::vector<T> x(It);
+    std::vector<T> out(It);
+
+    for(size_t i = 0; i < It; ++i){
+        x[i] = T(i + 1);
+    }
+
+    do_not_optimize(out.data());
+
+    timer::time_point t0 = timer::now();
+
+    for(size_t i = 0; i < It; ++i){
+        out[i] = std::pow(x[i], y);
+    }
+
+    clobber_memory();
+
+    timer::time_point t1 = timer::now();
+    auto us = elapsed<microseconds>(t0, t1);
+
+    std::cout << "std::pow array(x, " << y << ") [" << It << "]: " << us << "us" << std::endl;
+}
+
+template<typename T, size_t It, pow_precision P>
+void bench_approx_pow_n(T y){
+    std::vector<T> x(It);
+    std::vector<T> out(It);
+
+    for(size_t i = 0; i < It; ++i){
+        x[i] = T(i + 1);
+    }
+
+    do_not_optimize(out.data());
+
+    timer::time_point t0 = timer::now();
+
+    approx_pow_n<P>(x.data(), out.data(), It, y);
+
+    clobber_memory();
+
+    timer::time_point t1 = timer::now();
+    auto us = elapsed<microseconds>(t0, t1);
+
+    // Maximum relative error against std::pow
+    double error = 0;
+
+    for(size_t i = 0; i < It; ++i){
+        auto exact = std::pow(double(x[i]), double(y));
+        error = std::max(error, std::fabs((out[i] - exact) / exact));
+    }
+
+    std::cout << "approx_pow_n<" << precision_name(P) << ">(x, " << y << ") [" << It << "]: " << us << "us, " << error << " relative error" << std::endl;
+}
+
+template<typename T, size_t It>
+void bench_pow(T y){
+    bench_c_pow<T, It>(y);
+    bench_std_pow<T, It>(y);
+    bench_approx_pow<T, It, pow_precision::low>(y);
+    bench_approx_pow<T, It, pow_precision::medium>(y);
+    bench_approx_pow<T, It, pow_precision::high>(y);
+
+    bench_std_pow_array<T, It>(y);
+    bench_approx_pow_n<T, It, pow_precision::low>(y);
+    bench_approx_pow_n<T, It, pow_precision::medium>(y);
+    bench_approx_pow_n<T, It, pow_precision::high>(y);
+}
+
+template<typename T>
+void bench_pow(const std::string& type){
+    for(T y : {T(0.5), T(1.5), T(2.5)}){
+        std::cout << type << std::endl;
+
+        bench_pow<T, 1000>(y);
+        bench_pow<T, 100000>(y);
+        bench_pow<T, 10000000>(y);
+    }
+}
+
+int main(){
+    bench_pow<float>("float");
+    bench_pow<double>("double");
+
+    return 0;
+}
@@ -0,0 +1,88 @@
+//=======================================================================
+// Copyright (c) 2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#include <algorithm>
+#include <iostream>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "barrier.hpp"
+#include "pow.hpp"
+#include "timer.hpp"
+
+using timer = std::chrono::high_resolution_clock;
+using nanoseconds = std::chrono::nanoseconds;
+
+// Each measurement computes at least this number of powers
+static constexpr size_t elements = 10000000;
+
+template<typename T, typename Functor>
+void bench_batch(const std::string& name, const std::vector<T>& x, std::vector<T>& out, int n, Functor functor){
+    size_t repeat = std::max<size_t>(1, elements / x.size());
+
+    do_not_optimize(out.data());
+
+    timer::time_point t0 = timer::now();
+
+    for(size_t r = 0; r < repeat; ++r){
+        functor(x.data(), out.data(), x.size(), n);
+        clobber_memory();
+    }
+
+    timer::time_point t1 = timer::now();
+    auto ns = std::max<size_t>(1, elapsed<nanoseconds>(t0, t1));
+
+    std::cout << name << "(x, " << n << ") [" << x.size() << "]: " << double(x.size() * repeat) / ns << " elements/ns" << std::endl;
+}
+
+template<typename T>
+void bench_pow(const std::string& type, size_t size, int n){
+    std::mt19937_64 generator;
+    std::uniform_real_distribution<T> distribution(T(0.5), T(1.5));
+
+    std::vector<T> x(size);
+    std::vector<T> out(size);
+
+    for(auto& v : x){
+        v = distribution(generator);
+    }
+
+    bench_batch(type + " std::pow", x, out, n, [](const T* x, T* out, size_t len, int n){
+        for(size_t i = 0; i < len; ++i){
+            out[i] = std::pow(x[i], n);
+        }
+    });
+
+    bench_batch(type + " fast_pow", x, out, n, [](const T* x, T* out, size_t len, int n){
+        for(size_t i = 0; i < len; ++i){
+            out[i] = fast_pow(x[i], n);
+        }
+    });
+
+    bench_batch(type + " pow_n", x, out, n, [](const T* x, T* out, size_t len, int n){
+        pow_n(x, out, len, n);
+    });
+}
+
+template<typename T>
+void bench_pow(const std::string& type){
+    for(size_t size : {1000UL, 10000UL, 100000UL, 1000000UL, 10000000UL}){
+        for(int n : {2, 5, 15, 31, 64}){
+            bench_pow<T>(type, size, n);
+        }
+    }
+}
+
+int main(){
+    bench_pow<float>("float");
+    bench_pow<double>("double");
+
+    return 0;
+}
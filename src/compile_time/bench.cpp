@@ -0,0 +1,170 @@
+//=======================================================================
+// Copyright (c) 2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#include <cstddef>
+#include <cstdio>
+#include <functional>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "compile_bench.hpp"
+
+/*
+ * Compile time of the template metaprogramming techniques, for instances of
+ * growing sizes: the recursion depth of sqrt, the number of named parameters
+ * of configurable and the number of arguments of the fold expressions.
+ */
+
+struct variant {
+    std::string name;
+    std::function<compile_bench::measure(std::size_t)> bench;
+};
+
+void bench(const std::string& name, const std::string& title, const std::vector<variant>& variants, const std::vector<std::size_t>& sizes){
+    std::cout << "Start " << name << std::endl;
+
+    std::vector<std::string> series;
+    std::vector<std::vector<compile_bench::measure>> results;
+
+    for(auto& v : variants){
+        series.push_back(v.name);
+        results.emplace_back();
+
+        for(auto size : sizes){
+            results.back().push_back(v.bench(size));
+        }
+    }
+
+    compile_bench::output_graphs(name, title, series, sizes, results);
+}
+
+// One of the src/sqrt implementations, computing sqrt(2^n)
+variant sqrt_variant(const std::string& name, const std::vector<std::string>& flags){
+    return {name, [name, flags](std::size_t n){
+        auto sqrt_flags = flags;
+        sqrt_flags.push_back("-std=c++14");
+        sqrt_flags.push_back("-DSQRT_VALUE=" + std::to_string(std::size_t(1) << n) + "ULL");
+
+        return compile_bench::bench(COMPILE_BENCH_ROOT "/src/sqrt/" + name + ".cpp", sqrt_flags);
+    }};
+}
+
+// A source file generated for the size n
+variant generated_variant(const std::string& name, std::string (*generate)(std::size_t), const std::vector<std::string>& flags){
+    return {name, [name, generate, flags](std::size_t n){
+        auto source = compile_bench::write_source(name, generate(n));
+        auto result = compile_bench::bench(source, flags);
+        std::remove(source.c_str());
+        return result;
+    }};
+}
+
+// configurable_v2 with n named parameters, each of them looked up once
+std::string configurable(std::size_t n, const std::string& lookup){
+    std::ostringstream source;
+
+    source << "#include \"configurable.hpp\"\n\n";
+    source << "template<int I>\nstruct option_id;\n\n";
+    source << "template<int I, int V>\nstruct option : value_conf_t<option_id<I>, int, V> {};\n\n";
+
+    source << "template<typename... Args>\nstruct configurable {\n";
+    for(std::size_t i = 0; i < n; ++i){
+        source << "    static constexpr const auto O" << i << " = " << lookup << "get_value<option<" << i << ", 0>, Args...>::value;\n";
+    }
+
+    source << "\n    static_assert(" << lookup << "is_valid<" << lookup << "tmp_list<";
+    for(std::size_t i = 0; i < n; ++i){
+        source << (i ? ", " : "") << "option_id<" << i << ">";
+    }
+    source << ">, Args...>::value, \"Invalid parameters type\");\n};\n\n";
+
+    source << "using configurable_t = configurable<";
+    for(std::size_t i = 0; i < n; ++i){
+        source << (i ? ", " : "") << "option<" << i << ", " << (i + 1) << ">";
+    }
+    source << ">;\n\n";
+
+    source << "int main(){\n    return 0";
+    for(std::size_t i = 0; i < n; ++i){
+        source << " + configurable_t::O" << i;
+    }
+    source << ";\n}\n";
+
+    return source.str();
+}
+
+std::string configurable_recursive(std::size_t n){
+    return configurable(n, "recursive_lookup::");
+}
+
+std::string configurable_flat(std::size_t n){
+    return configurable(n, "");
+}
+
+// The sum of n arguments
+std::string sum_arguments(std::size_t n){
+    std::ostringstream source;
+
+    source << "int main(){\n    return sum(";
+    for(std::size_t i = 0; i < n; ++i){
+        source << (i ? ", " : "") << i;
+    }
+    source << ");\n}\n";
+
+    return source.str();
+}
+
+// old_sum of src/fold_expressions.cpp
+std::string sum_recursive(std::size_t n){
+    return "auto sum(){\n    return 0;\n}\n\n"
+           "template<typename T1, typename... T>\nauto sum(T1 s, T... ts){\n    return s + sum(ts...);\n}\n\n"
+           + sum_arguments(n);
+}
+
+// fold_sum_1 of src/fold_expressions.cpp
+std::string sum_fold(std::size_t n){
+    return "template<typename... T>\nauto sum(T... s){\n    return (s + ...);\n}\n\n"
+           + sum_arguments(n);
+}
+
+int main(){
+    // tmp instantiates both branches of its condition, its depth is N and
+    // not sqrt(N), it cannot go further than the depth limit
+    bench("sqrt_small", "sqrt(2^n) (small values)", {
+            sqrt_variant("constexpr", {"-fconstexpr-depth=10000"}),
+            sqrt_variant("tmp", {"-ftemplate-depth=10000"}),
+            sqrt_variant("smart_constexpr", {}),
+            sqrt_variant("smart_tmp", {}),
+            sqrt_variant("ct_math_constexpr", {}),
+            sqrt_variant("ct_math_tmp", {})
+        }, {6, 7, 8, 9, 10, 11, 12, 13});
+
+    // The smart_* implementations compute mid * mid and overflow for the
+    // large values, they still compile but their result is wrong
+    bench("sqrt", "sqrt(2^n)", {
+            sqrt_variant("smart_constexpr", {}),
+            sqrt_variant("smart_tmp", {}),
+            sqrt_variant("ct_math_constexpr", {}),
+            sqrt_variant("ct_math_tmp", {})
+        }, {20, 26, 32, 38, 44, 50, 56, 62});
+
+    bench("configurable", "configurable with n parameters", {
+            generated_variant("recursive", configurable_recursive, {"-std=c++14"}),
+            generated_variant("flat", configurable_flat, {"-std=c++14"})
+        }, {4, 8, 16, 32, 48, 64, 96, 128});
+
+    bench("fold", "sum of n arguments", {
+            generated_variant("recursive", sum_recursive, {"-std=c++17"}),
+            generated_variant("fold", sum_fold, {"-std=c++17"})
+        }, {16, 32, 64, 128, 256, 512});
+
+    graphs::output(graphs::Output::GOOGLE);
+
+    return 0;
+}
@@ -0,0 +1,148 @@
+//=======================================================================
+// Copyright (c) 2014 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#include <random>
+#include <array>
+#include <vector>
+#include <list>
+#include <algorithm>
+#include <deque>
+#include <thread>
+#include <iostream>
+#include <string>
+
+#include "plf_timsort.h"
+#include "plf_colony.h"
+
+#include "bench.hpp"
+#include "policies.hpp"
+#include "concurrent_bench.hpp"
+#include "concurrent_colony.hpp"
+
+// tested types
+
+// trivial type with parametrized size
+template<int N>
+struct Trivial {
+    std::size_t a;
+    std::array<unsigned char, N-sizeof(a)> b;
+    bool operator<(const Trivial &other) const { return a < other.a; }
+};
+
+template<>
+struct Trivial<sizeof(std::size_t)> {
+    std::size_t a;
+    bool operator<(const Trivial &other) const { return a < other.a; }
+};
+
+// non trivial, quite expensive to copy but easy to move (with noexcept)
+class NonTrivialStringMovableNoExcept {
+    private:
+        std::string data{"some pretty long string to make sure it is not optimized with SSO"};
+
+    public:
+        std::size_t a{0};
+        NonTrivialStringMovableNoExcept() = default;
+        NonTrivialStringMovableNoExcept(std::size_t a): a(a) {}
+        NonTrivialStringMovableNoExcept(const NonTrivialStringMovableNoExcept &) = default;
+        NonTrivialStringMovableNoExcept(NonTrivialStringMovableNoExcept &&) noexcept = default;
+        ~NonTrivialStringMovableNoExcept() = default;
+        NonTrivialStringMovableNoExcept &operator=(const NonTrivialStringMovableNoExcept &) = default;
+        NonTrivialStringMovableNoExcept &operator=(NonTrivialStringMovableNoExcept &&other) noexcept {
+            std::swap(data, other.data);
+            std::swap(a, other.a);
+            return *this;
+        }
+        bool operator<(const NonTrivialStringMovableNoExcept &other) const { return a < other.a; }
+};
+
+using TrivialSmall   = Trivial<8>;
+using TrivialMedium  = Trivial<32>;
+using TrivialLarge   = Trivial<128>;
+
+// Define all benchmarks, the groups are the number of threads
+
+template<typename Mix>
+struct bench_contention {
+    template<typename T>
+    struct type {
+        static void run(){
+            new_graph<T>("contention_" + std::to_string(Mix::find) + "_" + std::to_string(Mix::write) + "_" + std::to_string(Mix::insert), "ops/ms");
+
+            auto threads = {1, 2, 4, 8, 16};
+            std::size_t size = 10000;
+
+            bench_concurrent<std::vector<T>, global_mutex, Mix>("vector_mutex", size, threads);
+            bench_concurrent<std::list<T>,   global_mutex, Mix>("list_mutex",   size, threads);
+            bench_concurrent<std::deque<T>,  global_mutex, Mix>("deque_mutex",  size, threads);
+
+            bench_concurrent<std::vector<T>, rw_lock, Mix>("vector_rwlock", size, threads);
+            bench_concurrent<std::list<T>,   rw_lock, Mix>("list_rwlock",   size, threads);
+            bench_concurrent<std::deque<T>,  rw_lock, Mix>("deque_rwlock",  size, threads);
+
+            bench_concurrent<std::vector<T>, sharded, Mix>("vector_sharded", size, threads);
+            bench_concurrent<std::list<T>,   sharded, Mix>("list_sharded",   size, threads);
+            bench_concurrent<std::deque<T>,  sharded, Mix>("deque_sharded",  size, threads);
+        }
+    };
+};
+
+// Several threads filling the same container, the groups are the number of
+// threads
+
+template<typename T>
+struct bench_producers_insert {
+    static void run(){
+        new_graph<T>("producers_insert", "ops/ms");
+
+        auto threads = {1, 2, 4, 8, 16};
+
+        bench_producers<mutex_producers<std::deque<T>>,  false>("deque_mutex",  threads);
+        bench_producers<mutex_producers<plf::colony<T>>, false>("colony_mutex", threads);
+        bench_producers<concurrent_colony<T>,            false>("concurrent_colony", threads);
+    }
+};
+
+template<typename T>
+struct bench_producers_erase {
+    static void run(){
+        new_graph<T>("producers_insert_erase", "ops/ms");
+
+        auto threads = {1, 2, 4, 8, 16};
+
+        bench_producers<mutex_producers<plf::colony<T>>, true>("colony_mutex", threads);
+        bench_producers<concurrent_colony<T>,            true>("concurrent_colony", threads);
+    }
+};
+
+//Launch the benchmark
+
+template<typename ...Types>
+void bench_all(){
+    // find / write / insert percentages
+    bench_types<bench_contention<mix<100, 0, 0>>::template type, Types...>();
+    bench_types<bench_contention<mix<90, 9, 1>>::template type,  Types...>();
+    bench_types<bench_contention<mix<50, 40, 10>>::template type, Types...>();
+    bench_types<bench_contention<mix<10, 60, 30>>::template type, Types...>();
+
+    bench_types<bench_producers_insert, Types...>();
+    bench_types<bench_producers_erase,  Types...>();
+}
+
+int main(){
+    //Launch all the graphs
+    bench_all<
+        TrivialSmall,
+        TrivialMedium,
+        TrivialLarge,
+        NonTrivialStringMovableNoExcept>();
+
+    //Generate the graphs
+    graphs::output(graphs::Output::GOOGLE);
+
+    return 0;
+}
@@ -0,0 +1,254 @@
+//=======================================================================
+// Copyright (c) 2014 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#include <atomic>
+#include <cstddef>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "plf_timsort.h"
+#include "plf_colony.h"
+
+#include "concurrent_colony.hpp"
+
+/*
+ * Check the reclamation of concurrent_colony: a thread iterating over the
+ * container keeps pointers to the elements of the previous shards while
+ * another thread erases and reclaims the elements of these shards.
+ */
+
+namespace {
+
+constexpr const std::size_t max_objects = 1 << 21;
+
+// The destroyed objects, by id
+std::atomic<std::size_t> objects{0};
+std::atomic<bool> destroyed[max_objects];
+
+// Element recording its destruction, each copy is a new object
+struct tracked {
+    std::size_t value;
+    std::size_t id = objects++;
+
+    tracked(std::size_t value) : value(value) {}
+    tracked(const tracked& rhs) : value(rhs.value) {}
+
+    ~tracked(){
+        if(id < max_objects){
+            destroyed[id] = true;
+        }
+    }
+};
+
+// A visited element, its id is saved since the element itself may be destroyed
+struct visited_element {
+    std::size_t id;
+
+    visited_element(const tracked& element) : id(element.id) {}
+
+    bool alive() const {
+        return !destroyed[id];
+    }
+};
+
+using colony_type = concurrent_colony<tracked, 4>;
+
+std::size_t failures = 0;
+
+void check(bool condition, const char* message){
+    if(!condition){
+        std::cout << "FAILED: " << message << std::endl;
+        ++failures;
+    }
+}
+
+// The reader is the owner of the first shard, the eraser of the second one.
+// The reader waits in the third shard for the eraser to erase and reclaim an
+// element that it has kept.
+void scenario(){
+    colony_type container;
+
+    auto reader = container.make_producer();
+    auto eraser = container.make_producer();
+    auto other  = container.make_producer();
+
+    auto before = eraser.insert(1);
+    auto during = eraser.insert(2);
+    eraser.insert(3);
+    other.insert(4);
+
+    check(eraser.erase(before), "first erase");
+    check(!eraser.erase(before), "second erase of the same element is rejected");
+
+    std::atomic<bool> visited{false};
+    std::atomic<bool> reclaimed{false};
+
+    std::thread eraser_thread([&]{
+        while(!visited.load()){
+            std::this_thread::yield();
+        }
+
+        eraser.erase(during);
+        eraser.reclaim();
+
+        reclaimed = true;
+    });
+
+    std::vector<visited_element> kept;
+
+    reader.for_each([&](tracked& element){
+        check(element.value != 1, "an element erased before the iteration is skipped");
+
+        if(element.value == 4){
+            visited = true;
+
+            while(!reclaimed.load()){
+                std::this_thread::yield();
+            }
+
+            for(auto& previous : kept){
+                check(previous.alive(), "a visited element is not destroyed during the iteration");
+            }
+        } else {
+            kept.emplace_back(element);
+        }
+    });
+
+    eraser_thread.join();
+
+    check(kept.size() == 2, "the elements of the previous shard are visited");
+
+    eraser.reclaim();
+
+    check(container.size() == 2, "the erased elements are destroyed after the iteration");
+}
+
+// The owner of a shard erases an element during an iteration and leaves, the
+// element is destroyed by the reclamation of the whole container
+void orphan(){
+    colony_type container;
+
+    auto reader = container.make_producer();
+    reader.insert(1);
+
+    std::atomic<bool> visited{false};
+    std::atomic<bool> left{false};
+
+    std::thread owner_thread([&]{
+        auto owner = container.make_producer();
+        auto element = owner.insert(2);
+
+        while(!visited.load()){
+            std::this_thread::yield();
+        }
+
+        owner.erase(element);
+    });
+
+    reader.for_each([&](tracked& element){
+        if(element.value == 1){
+            visited = true;
+            owner_thread.join();
+            left = true;
+        }
+    });
+
+    check(left.load(), "the owner left during the iteration");
+    check(container.size() == 2, "the element erased during the iteration is not destroyed");
+
+    container.reclaim();
+
+    check(container.size() == 1, "the element of the shard without owner is destroyed");
+}
+
+// One thread keeps pointers across the shards while another one inserts,
+// erases and reclaims
+void stress(){
+    constexpr const std::size_t rounds = 2000;
+    constexpr const std::size_t batch = 64;
+
+    colony_type container;
+
+    auto reader = container.make_producer();
+    auto writer = container.make_producer();
+    auto other  = container.make_producer();
+
+    for(std::size_t i = 0; i < batch; ++i){
+        other.insert(batch + i);
+    }
+
+    std::atomic<bool> done{false};
+
+    std::thread writer_thread([&]{
+        std::vector<colony_type::handle> inserted;
+
+        for(std::size_t r = 0; r < rounds; ++r){
+            for(std::size_t i = 0; i < batch; ++i){
+                inserted.push_back(writer.insert(i));
+            }
+
+            for(auto& element : inserted){
+                writer.erase(element);
+            }
+
+            inserted.clear();
+            writer.reclaim();
+        }
+
+        done = true;
+    });
+
+    std::size_t iterations = 0;
+
+    while(!done.load()){
+        std::vector<visited_element> kept;
+
+        // The elements of the writer are kept, they are checked while the
+        // elements of the last shard are visited
+        reader.for_each([&](tracked& element){
+            if(element.value < batch){
+                kept.emplace_back(element);
+                return;
+            }
+
+            std::this_thread::yield();
+
+            for(auto& previous : kept){
+                check(previous.alive(), "a visited element is not destroyed before the end of the iteration");
+            }
+        });
+
+        ++iterations;
+    }
+
+    writer_thread.join();
+    writer.reclaim();
+
+    check(container.size() == batch, "all the erased elements are destroyed");
+
+    std::cout << iterations << " iterations during the erasures" << std::endl;
+}
+
+} //end of anonymous namespace
+
+int main(){
+    scenario();
+    orphan();
+    stress();
+
+    check(objects < max_objects, "enough ids for all the objects");
+
+    if(failures){
+        std::cout << failures << " checks failed" << std::endl;
+        return 1;
+    }
+
+    std::cout << "All checks passed" << std::endl;
+
+    return 0;
+}
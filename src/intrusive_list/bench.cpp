@@ -183,6 +183,99 @@ struct bench_random_insert {
     }
 };
 
+template<typename T>
+struct bench_prefetch_write {
+    static void run(){
+        new_graph<T>("prefetch_write", "us");
+
+        auto sizes = {100000, 200000, 300000, 400000, 500000, 600000, 700000, 800000, 900000, 1000000};
+        bench<std::list<T>,                                 microseconds, FilledRandom, Write>("list",                         sizes);
+        bench<std::list<T>,                                 microseconds, FilledRandom, prefetch<1>::Write>("list_pf1",        sizes);
+        bench<std::list<T>,                                 microseconds, FilledRandom, prefetch<2>::Write>("list_pf2",        sizes);
+        bench<std::list<T>,                                 microseconds, FilledRandom, prefetch<4>::Write>("list_pf4",        sizes);
+        bench<std::list<T>,                                 microseconds, FilledRandom, prefetch<8>::Write>("list_pf8",        sizes);
+        bench<std::list<T>,                                 microseconds, FilledRandom, prefetch<16>::Write>("list_pf16",      sizes);
+        bench<typename intrusive_list_type<T::size>::L1,    microseconds, FilledRandom, Write>("normal_ilist",                 sizes);
+        bench<typename intrusive_list_type<T::size>::L1,    microseconds, FilledRandom, prefetch<1>::Write>("normal_ilist_pf1",  sizes);
+        bench<typename intrusive_list_type<T::size>::L1,    microseconds, FilledRandom, prefetch<2>::Write>("normal_ilist_pf2",  sizes);
+        bench<typename intrusive_list_type<T::size>::L1,    microseconds, FilledRandom, prefetch<4>::Write>("normal_ilist_pf4",  sizes);
+        bench<typename intrusive_list_type<T::size>::L1,    microseconds, FilledRandom, prefetch<8>::Write>("normal_ilist_pf8",  sizes);
+        bench<typename intrusive_list_type<T::size>::L1,    microseconds, FilledRandom, prefetch<16>::Write>("normal_ilist_pf16", sizes);
+    }
+};
+
+template<typename T>
+struct bench_prefetch_find {
+    static void run(){
+        new_graph<T>("prefetch_find", "us");
+
+        auto sizes = {1000, 2000, 3000, 4000, 5000, 6000, 7000, 8000, 9000, 10000};
+        bench<std::list<T>,                                 microseconds, FilledRandom, Find>("list",                          sizes);
+        bench<std::list<T>,                                 microseconds, FilledRandom, prefetch<1>::Find>("list_pf1",         sizes);
+        bench<std::list<T>,                                 microseconds, FilledRandom, prefetch<2>::Find>("list_pf2",         sizes);
+        bench<std::list<T>,                                 microseconds, FilledRandom, prefetch<4>::Find>("list_pf4",         sizes);
+        bench<std::list<T>,                                 microseconds, FilledRandom, prefetch<8>::Find>("list_pf8",         sizes);
+        bench<std::list<T>,                                 microseconds, FilledRandom, prefetch<16>::Find>("list_pf16",       sizes);
+        bench<typename intrusive_list_type<T::size>::L1,    microseconds, FilledRandom, Find>("normal_ilist",                  sizes);
+        bench<typename intrusive_list_type<T::size>::L1,    microseconds, FilledRandom, prefetch<1>::Find>("normal_ilist_pf1",   sizes);
+        bench<typename intrusive_list_type<T::size>::L1,    microseconds, FilledRandom, prefetch<2>::Find>("normal_ilist_pf2",   sizes);
+        bench<typename intrusive_list_type<T::size>::L1,    microseconds, FilledRandom, prefetch<4>::Find>("normal_ilist_pf4",   sizes);
+        bench<typename intrusive_list_type<T::size>::L1,    microseconds, FilledRandom, prefetch<8>::Find>("normal_ilist_pf8",   sizes);
+        bench<typename intrusive_list_type<T::size>::L1,    microseconds, FilledRandom, prefetch<16>::Find>("normal_ilist_pf16", sizes);
+    }
+};
+
+template<typename T>
+struct bench_interleaved_iterate {
+    static void run(){
+        new_graph<T>("interleaved_iterate", "us");
+
+        auto sizes = {100000, 200000, 300000, 400000, 500000, 600000, 700000, 800000, 900000, 1000000};
+        bench<std::list<T>,                                 microseconds, FilledRandom, Iterate>("list",                                                          sizes);
+        bench<std::list<T>,                                 microseconds, interleaved<2>::FilledRandomCursors, interleaved<2>::Iterate>("list_x2",                  sizes);
+        bench<std::list<T>,                                 microseconds, interleaved<4>::FilledRandomCursors, interleaved<4>::Iterate>("list_x4",                  sizes);
+        bench<std::list<T>,                                 microseconds, interleaved<8>::FilledRandomCursors, interleaved<8>::Iterate>("list_x8",                  sizes);
+        bench<typename intrusive_list_type<T::size>::L1,    microseconds, FilledRandom, Iterate>("normal_ilist",                                                  sizes);
+        bench<typename intrusive_list_type<T::size>::L1,    microseconds, interleaved<2>::FilledRandomCursors, interleaved<2>::Iterate>("normal_ilist_x2",          sizes);
+        bench<typename intrusive_list_type<T::size>::L1,    microseconds, interleaved<4>::FilledRandomCursors, interleaved<4>::Iterate>("normal_ilist_x4",          sizes);
+        bench<typename intrusive_list_type<T::size>::L1,    microseconds, interleaved<8>::FilledRandomCursors, interleaved<8>::Iterate>("normal_ilist_x8",          sizes);
+    }
+};
+
+template<typename T>
+struct bench_interleaved_write {
+    static void run(){
+        new_graph<T>("interleaved_write", "us");
+
+        auto sizes = {100000, 200000, 300000, 400000, 500000, 600000, 700000, 800000, 900000, 1000000};
+        bench<std::list<T>,                                 microseconds, FilledRandom, Write>("list",                                                            sizes);
+        bench<std::list<T>,                                 microseconds, interleaved<2>::FilledRandomCursors, interleaved<2>::Write>("list_x2",                    sizes);
+        bench<std::list<T>,                                 microseconds, interleaved<4>::FilledRandomCursors, interleaved<4>::Write>("list_x4",                    sizes);
+        bench<std::list<T>,                                 microseconds, interleaved<8>::FilledRandomCursors, interleaved<8>::Write>("list_x8",                    sizes);
+        bench<typename intrusive_list_type<T::size>::L1,    microseconds, FilledRandom, Write>("normal_ilist",                                                    sizes);
+        bench<typename intrusive_list_type<T::size>::L1,    microseconds, interleaved<2>::FilledRandomCursors, interleaved<2>::Write>("normal_ilist_x2",            sizes);
+        bench<typename intrusive_list_type<T::size>::L1,    microseconds, interleaved<4>::FilledRandomCursors, interleaved<4>::Write>("normal_ilist_x4",            sizes);
+        bench<typename intrusive_list_type<T::size>::L1,    microseconds, interleaved<8>::FilledRandomCursors, interleaved<8>::Write>("normal_ilist_x8",            sizes);
+    }
+};
+
+template<typename T>
+struct bench_interleaved_find {
+    static void run(){
+        new_graph<T>("interleaved_find", "us");
+
+        auto sizes = {1000, 2000, 3000, 4000, 5000, 6000, 7000, 8000, 9000, 10000};
+        bench<std::list<T>,                                 microseconds, FilledRandom, Find>("list",                                                             sizes);
+        bench<std::list<T>,                                 microseconds, interleaved<2>::FilledRandomCursors, interleaved<2>::Find>("list_x2",                     sizes);
+        bench<std::list<T>,                                 microseconds, interleaved<4>::FilledRandomCursors, interleaved<4>::Find>("list_x4",                     sizes);
+        bench<std::list<T>,                                 microseconds, interleaved<8>::FilledRandomCursors, interleaved<8>::Find>("list_x8",                     sizes);
+        bench<typename intrusive_list_type<T::size>::L1,    microseconds, FilledRandom, Find>("normal_ilist",                                                     sizes);
+        bench<typename intrusive_list_type<T::size>::L1,    microseconds, interleaved<2>::FilledRandomCursors, interleaved<2>::Find>("normal_ilist_x2",             sizes);
+        bench<typename intrusive_list_type<T::size>::L1,    microseconds, interleaved<4>::FilledRandomCursors, interleaved<4>::Find>("normal_ilist_x4",             sizes);
+        bench<typename intrusive_list_type<T::size>::L1,    microseconds, interleaved<8>::FilledRandomCursors, interleaved<8>::Find>("normal_ilist_x8",             sizes);
+    }
+};
+
 //Launch the benchmark
 
 template<typename ...Types>
@@ -195,6 +288,11 @@ void bench_all(){
     bench_types<bench_write,            Types...>();
     bench_types<bench_iterate,          Types...>();
     bench_types<bench_random_insert,    Types...>();
+    bench_types<bench_prefetch_write,       Types...>();
+    bench_types<bench_prefetch_find,        Types...>();
+    bench_types<bench_interleaved_iterate,  Types...>();
+    bench_types<bench_interleaved_write,    Types...>();
+    bench_types<bench_interleaved_find,     Types...>();
 }
 
 } //end of anonymous namespace
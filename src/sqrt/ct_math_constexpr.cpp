@@ -0,0 +1,17 @@
+//=======================================================================
+// Copyright (c) 2014 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#include <cstddef>
+#include <iostream>
+
+#include "ct_math.hpp"
+
+static constexpr const std::size_t result = ct_math::isqrt(SQRT_VALUE);
+
+int main(){
+    std::cout << result << std::endl;
+}
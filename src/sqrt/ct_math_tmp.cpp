@@ -0,0 +1,15 @@
+//=======================================================================
+// Copyright (c) 2014 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#include <cstddef>
+#include <iostream>
+
+#include "ct_math.hpp"
+
+int main(){
+    std::cout << ct_math::tmp::isqrt<SQRT_VALUE>::value << std::endl;
+}
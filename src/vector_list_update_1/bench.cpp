@@ -22,6 +22,14 @@
 #include "plf_timsort.h"
 #include "plf_colony.h"
 
+#include "unrolled_list.hpp"
+#include "flat_btree.hpp"
+#include "indexed_list.hpp"
+#include "relocating_vector.hpp"
+#include "small_vector.hpp"
+#include "arena_allocator.hpp"
+#include "policy_vector.hpp"
+
 #include "bench.hpp"
 #include "policies.hpp"
 
@@ -94,6 +102,20 @@ struct Trivial<sizeof(std::size_t)> {
     bool operator<(const Trivial &other) const { return a < other.a; }
 };
 
+// The members of the trivial types as a tuple, for the soa policy_vector
+template<typename T>
+struct members {};
+
+template<int N>
+struct members<Trivial<N>> {
+    using type = std::tuple<std::size_t, std::array<unsigned char, N-sizeof(std::size_t)>>;
+};
+
+template<>
+struct members<Trivial<sizeof(std::size_t)>> {
+    using type = std::tuple<std::size_t>;
+};
+
 // non trivial, quite expensive to copy but easy to move (noexcept not set)
 class NonTrivialStringMovable {
     private:
@@ -128,6 +150,39 @@ class NonTrivialStringMovableNoExcept {
         bool operator<(const NonTrivialStringMovableNoExcept &other) const { return a < other.a; }
 };
 
+// non trivial, quite expensive to copy but easy to move, with the string
+// kept out of the object so that it can be relocated with a memcpy (the
+// libstdc++ std::string may point into itself)
+class NonTrivialStringRelocatable {
+    private:
+        std::unique_ptr<std::string> data{new std::string("some pretty long string to make sure it is not optimized with SSO")};
+
+    public:
+        std::size_t a{0};
+        NonTrivialStringRelocatable() = default;
+        NonTrivialStringRelocatable(std::size_t a): a(a) {}
+        NonTrivialStringRelocatable(const NonTrivialStringRelocatable &other) : data(new std::string(*other.data)), a(other.a) {}
+        NonTrivialStringRelocatable(NonTrivialStringRelocatable &&) noexcept = default;
+        ~NonTrivialStringRelocatable() = default;
+
+        NonTrivialStringRelocatable &operator=(const NonTrivialStringRelocatable &other){
+            *data = *other.data;
+            a = other.a;
+            return *this;
+        }
+
+        NonTrivialStringRelocatable &operator=(NonTrivialStringRelocatable &&other) noexcept {
+            std::swap(data, other.data);
+            std::swap(a, other.a);
+            return *this;
+        }
+
+        bool operator<(const NonTrivialStringRelocatable &other) const { return a < other.a; }
+};
+
+template<>
+struct is_trivially_relocatable<NonTrivialStringRelocatable> : std::true_type {};
+
 // non trivial, quite expensive to copy and move
 template<int N>
 class NonTrivialArray {
@@ -144,6 +199,49 @@ class NonTrivialArray {
         bool operator<(const NonTrivialArray &other) const { return a < other.a; }
 };
 
+// non trivial, quite expensive to copy, counting its copies and its moves,
+// with or without noexcept moves
+template<bool NoExcept>
+class CountedString {
+    private:
+        std::string data{"some pretty long string to make sure it is not optimized with SSO"};
+
+    public:
+        static std::size_t copies;
+        static std::size_t moves;
+
+        std::size_t a{0};
+        CountedString() = default;
+        CountedString(std::size_t a): a(a) {}
+        CountedString(const CountedString &other) : data(other.data), a(other.a) { ++copies; }
+        CountedString(CountedString &&other) noexcept(NoExcept) : data(std::move(other.data)), a(other.a) { ++moves; }
+        ~CountedString() = default;
+
+        CountedString &operator=(const CountedString &other){
+            data = other.data;
+            a = other.a;
+            ++copies;
+            return *this;
+        }
+
+        CountedString &operator=(CountedString &&other) noexcept(NoExcept) {
+            data = std::move(other.data);
+            a = other.a;
+            ++moves;
+            return *this;
+        }
+
+        bool operator<(const CountedString &other) const { return a < other.a; }
+
+        static void reset(){
+            copies = 0;
+            moves = 0;
+        }
+};
+
+template<bool NoExcept> std::size_t CountedString<NoExcept>::copies = 0;
+template<bool NoExcept> std::size_t CountedString<NoExcept>::moves = 0;
+
 // type definitions for testing and invariants check
 using TrivialSmall   = Trivial<8>;       static_assert(is_trivial_of_size<TrivialSmall>(8),        "Invalid type");
 using TrivialMedium  = Trivial<32>;      static_assert(is_trivial_of_size<TrivialMedium>(32),      "Invalid type");
@@ -154,11 +252,63 @@ using TrivialMonster = Trivial<4*1024>;  static_assert(is_trivial_of_size<Trivia
 static_assert(is_non_trivial_nothrow_movable<NonTrivialStringMovableNoExcept>(), "Invalid type");
 static_assert(is_non_trivial_non_nothrow_movable<NonTrivialStringMovable>(), "Invalid type");
 
+using CountedStringMovable        = CountedString<false>;
+using CountedStringMovableNoExcept = CountedString<true>;
+
+static_assert(is_non_trivial_nothrow_movable<CountedStringMovableNoExcept>(), "Invalid type");
+static_assert(is_non_trivial_non_nothrow_movable<CountedStringMovable>(), "Invalid type");
+
+static_assert(is_non_trivial_nothrow_movable<NonTrivialStringRelocatable>(), "Invalid type");
+
 using NonTrivialArrayMedium = NonTrivialArray<32>;
 static_assert(is_non_trivial_of_size<NonTrivialArrayMedium>(32), "Invalid type");
 
+static_assert(sizeof(policy_vector<TrivialSmall>) == sizeof(std::vector<TrivialSmall>), "The unused options must take no space");
+
+// All the members of the soa layout are compiled, not only the ones used by the benchmarks
+template class policy_vector<std::tuple<std::size_t, double, NonTrivialStringMovableNoExcept>, vector_policy::layout<vector_policy::soa>>;
+
+static_assert(std::is_same<policy_vector<members<TrivialMedium>::type, vector_policy::layout<vector_policy::soa>>::reference,
+    std::tuple<std::size_t&, std::array<unsigned char, 24>&>>::value, "The soa references are tuples of references");
+
 // Define all benchmarks
 
+// The configurations of policy_vector, as a family of series
+
+template<typename T,
+         typename DurationUnit,
+         template<class> class CreatePolicy,
+         template<class> class ...TestPolicy>
+void bench_policy_vectors(const std::initializer_list<int> &sizes){
+    using namespace vector_policy;
+
+    bench<policy_vector<T>,                              DurationUnit, CreatePolicy, TestPolicy...>("policy_vector", sizes);
+    bench<policy_vector<T, growth<4>>,                   DurationUnit, CreatePolicy, TestPolicy...>("policy_vector_growth_4", sizes);
+    bench<policy_vector<T, allocator<arena_allocator>>,  DurationUnit, CreatePolicy, TestPolicy...>("policy_vector_arena", sizes);
+    bench<policy_vector<T, thread_safe>,                 DurationUnit, CreatePolicy, TestPolicy...>("policy_vector_thread_safe", sizes);
+}
+
+// The soa policy_vector of the members of T, only for the types with members,
+// the second argument is nullptr
+
+template<typename T,
+         typename DurationUnit,
+         template<class> class CreatePolicy,
+         template<class> class ...TestPolicy>
+void bench_soa_vector(const std::initializer_list<int> &sizes, typename members<T>::type*){
+    using namespace vector_policy;
+
+    bench<policy_vector<typename members<T>::type, layout<soa>>, DurationUnit, CreatePolicy, TestPolicy...>("policy_vector_soa", sizes);
+}
+
+template<typename T,
+         typename DurationUnit,
+         template<class> class CreatePolicy,
+         template<class> class ...TestPolicy>
+void bench_soa_vector(const std::initializer_list<int> &, ...){
+    //No tuple for this type
+}
+
 template<typename T>
 struct bench_fill_back {
     static void run(){
@@ -171,11 +321,15 @@ struct bench_fill_back {
 
         bench<std::vector<T>, microseconds, Empty, ReserveSize, FillBack>("vector_reserve", sizes);
 
+        bench<relocating_vector<T>, microseconds, Empty, FillBack>("relocating_vector", sizes);
+
         bench<plf::colony<T>, microseconds, Empty, InsertSimple>("colony",  sizes);
         bench<plf::colony<T>, microseconds, Empty, ReserveSize, InsertSimple>("colony_reserve", sizes);
 
         bench<plf::colony<T,std::allocator<T>, unsigned int>, microseconds, Empty, InsertSimple>("colony",  sizes);
         bench<plf::colony<T,std::allocator<T>, unsigned int>, microseconds, Empty, ReserveSize, InsertSimple>("colony_reserve", sizes);
+
+        bench_policy_vectors<T, microseconds, Empty, FillBack>(sizes);
     }
 };
 
@@ -191,6 +345,8 @@ struct bench_emplace_back {
         bench<plf::colony<T>, microseconds, Empty, EmplaceInsertSimple>("colony",  sizes);
         bench<std::vector<T>, microseconds, Empty, ReserveSize, EmplaceBack>("vector_reserve", sizes);
         bench<plf::colony<T>, microseconds, Empty, ReserveSize, EmplaceInsertSimple>("colony_reserve",  sizes);
+
+        bench_policy_vectors<T, microseconds, Empty, EmplaceBack>(sizes);
     }
 };
 
@@ -252,7 +408,16 @@ struct bench_random_insert {
         bench<std::vector<T>, milliseconds, FilledRandom, Insert>("vector", sizes);
         bench<std::list<T>,   milliseconds, FilledRandom, Insert>("list",   sizes);
         bench<std::deque<T>,  milliseconds, FilledRandom, Insert>("deque",  sizes);
+        bench<unrolled_list<T>, milliseconds, FilledRandom, Insert>("unrolled_list", sizes);
+        bench<relocating_vector<T>, milliseconds, FilledRandom, Insert>("relocating_vector", sizes);
         // colony is unordered
+
+        // Same positions found by binary search in sorted containers
+        bench<std::vector<T>, milliseconds, FilledSorted, InsertBinary>("vector_bsearch", sizes);
+        bench<std::deque<T>,  milliseconds, FilledSorted, InsertBinary>("deque_bsearch",  sizes);
+        bench<indexed_list<T>, milliseconds, FilledSorted, InsertBinary>("list_skiplist", sizes);
+
+        bench_policy_vectors<T, milliseconds, FilledRandom, Insert>(sizes);
     }
 };
 
@@ -266,11 +431,192 @@ struct bench_random_remove {
         bench<std::list<T>,   microseconds, FilledRandom, Erase>("list",   sizes);
         bench<std::deque<T>,  microseconds, FilledRandom, Erase>("deque",  sizes);
         bench<plf::colony<T>,  microseconds, FilledRandomInsert, Erase>("colony",  sizes);
+        bench<unrolled_list<T>, microseconds, FilledRandom, Erase>("unrolled_list", sizes);
 
         bench<std::vector<T>, microseconds, FilledRandom, RemoveErase>("vector_rem", sizes);
         bench<std::list<T>,   microseconds, FilledRandom, RemoveErase>("list_rem",   sizes);
         bench<std::deque<T>,  microseconds, FilledRandom, RemoveErase>("deque_rem",  sizes);
         bench<plf::colony<T>,  microseconds, FilledRandomInsert, RemoveErase>("colony_rem",  sizes);
+        bench<unrolled_list<T>, microseconds, FilledRandom, RemoveErase>("unrolled_list_rem", sizes);
+
+        bench<std::vector<T>, microseconds, FilledSorted, EraseBinary>("vector_bsearch", sizes);
+        bench<std::deque<T>,  microseconds, FilledSorted, EraseBinary>("deque_bsearch",  sizes);
+        bench<indexed_list<T>, microseconds, FilledSorted, EraseBinary>("list_skiplist", sizes);
+
+        bench_policy_vectors<T, microseconds, FilledRandom, Erase>(sizes);
+    }
+};
+
+template<typename T>
+struct bench_bulk_fill_back {
+    static void run(){
+        new_graph<T>("bulk_fill_back", "us");
+
+        auto sizes = { 100000, 200000, 300000, 400000, 500000, 600000, 700000, 800000, 900000, 1000000 };
+        bench<std::vector<T>, microseconds, EmptyPrepareBackup, FillBackBackup>("vector", sizes);
+        bench<std::list<T>,   microseconds, EmptyPrepareBackup, FillBackBackup>("list",   sizes);
+        bench<std::deque<T>,  microseconds, EmptyPrepareBackup, FillBackBackup>("deque",  sizes);
+        bench<plf::colony<T>, microseconds, EmptyPrepareBackup, FillBackBackup>("colony", sizes);
+
+        bench<std::vector<T>, microseconds, EmptyPrepareBackup, FillBackRange>("vector_range", sizes);
+        bench<std::list<T>,   microseconds, EmptyPrepareBackup, FillBackRange>("list_range",   sizes);
+        bench<std::deque<T>,  microseconds, EmptyPrepareBackup, FillBackRange>("deque_range",  sizes);
+        bench<plf::colony<T>, microseconds, EmptyPrepareBackup, FillBackRange>("colony_range", sizes);
+
+        bench<std::vector<T>, microseconds, EmptyPrepareBackup, AssignRange>("vector_assign", sizes);
+        bench<std::list<T>,   microseconds, EmptyPrepareBackup, AssignRange>("list_assign",   sizes);
+        bench<std::deque<T>,  microseconds, EmptyPrepareBackup, AssignRange>("deque_assign",  sizes);
+        // colony has no assign
+    }
+};
+
+template<typename T>
+struct bench_bulk_insert {
+    static void run(){
+        new_graph<T>("bulk_insert", "us");
+
+        auto sizes = {10000, 20000, 30000, 40000, 50000, 60000, 70000, 80000, 90000, 100000};
+        bench<std::vector<T>, microseconds, FilledRandom, InsertMiddle>("vector", sizes);
+        bench<std::list<T>,   microseconds, FilledRandom, InsertMiddle>("list",   sizes);
+        bench<std::deque<T>,  microseconds, FilledRandom, InsertMiddle>("deque",  sizes);
+        bench<plf::colony<T>, microseconds, FilledRandomInsert, InsertMiddle>("colony", sizes);
+
+        bench<std::vector<T>, microseconds, FilledRandom, InsertRangeMiddle>("vector_range", sizes);
+        bench<std::list<T>,   microseconds, FilledRandom, InsertRangeMiddle>("list_range",   sizes);
+        bench<std::deque<T>,  microseconds, FilledRandom, InsertRangeMiddle>("deque_range",  sizes);
+        bench<plf::colony<T>, microseconds, FilledRandomInsert, InsertRangeMiddle>("colony_range", sizes);
+    }
+};
+
+template<typename T>
+struct bench_bulk_erase {
+    static void run(){
+        new_graph<T>("bulk_erase", "us");
+
+        auto sizes = {10000, 20000, 30000, 40000, 50000, 60000, 70000, 80000, 90000, 100000};
+        bench<std::vector<T>, microseconds, FilledRandom, EraseMiddle>("vector", sizes);
+        bench<std::list<T>,   microseconds, FilledRandom, EraseMiddle>("list",   sizes);
+        bench<std::deque<T>,  microseconds, FilledRandom, EraseMiddle>("deque",  sizes);
+        bench<plf::colony<T>, microseconds, FilledRandomInsert, EraseMiddle>("colony", sizes);
+
+        bench<std::vector<T>, microseconds, FilledRandom, EraseRange>("vector_range", sizes);
+        bench<std::list<T>,   microseconds, FilledRandom, EraseRange>("list_range",   sizes);
+        bench<std::deque<T>,  microseconds, FilledRandom, EraseRange>("deque_range",  sizes);
+        bench<plf::colony<T>, microseconds, FilledRandomInsert, EraseRange>("colony_range", sizes);
+    }
+};
+
+// Count the copies and the moves of the elements done by the test policies
+template<typename Container,
+         template<class> class CreatePolicy,
+         template<class> class ...TestPolicy>
+void count_operations(const std::string& type, const std::initializer_list<int> &sizes){
+    using value_type = typename Container::value_type;
+
+    for(auto size : sizes) {
+        auto container = CreatePolicy<Container>::make(size);
+
+        value_type::reset();
+
+        run<TestPolicy...>(container, size);
+
+        graphs::new_result(type + "_copies", std::to_string(size), value_type::copies);
+        graphs::new_result(type + "_moves", std::to_string(size), value_type::moves);
+    }
+
+    CreatePolicy<Container>::clean();
+}
+
+// Reallocation and compaction, to be run with the counted types
+template<typename T>
+struct bench_compaction {
+    static void run(){
+        new_graph<T>("compaction", "us");
+
+        auto sizes = {10000, 20000, 30000, 40000, 50000, 60000, 70000, 80000, 90000, 100000};
+        bench<std::vector<T>, microseconds, Empty, FillBack>("vector_grow", sizes);
+        bench<std::deque<T>,  microseconds, Empty, FillBack>("deque_grow",  sizes);
+
+        bench<std::vector<T>, microseconds, FilledHalfErased, Shrink>("vector_shrink", sizes);
+        bench<std::deque<T>,  microseconds, FilledHalfErased, Shrink>("deque_shrink",  sizes);
+        bench<plf::colony<T>, microseconds, FilledHalfErased, Shrink>("colony_shrink", sizes);
+
+        bench<std::vector<T>, microseconds, FilledRandom, EraseFront>("vector_erase_front", sizes);
+        bench<std::deque<T>,  microseconds, FilledRandom, EraseFront>("deque_erase_front",  sizes);
+        bench<plf::colony<T>, microseconds, FilledRandomInsert, EraseFront>("colony_erase_front", sizes);
+
+        bench<plf::colony<T>, microseconds, FilledRandomInsert, Reshape>("colony_reshape", sizes);
+
+        new_graph<T>("compaction_operations", "operations");
+
+        count_operations<std::vector<T>, Empty, FillBack>("vector_grow", sizes);
+        count_operations<std::deque<T>,  Empty, FillBack>("deque_grow",  sizes);
+
+        count_operations<std::vector<T>, FilledHalfErased, Shrink>("vector_shrink", sizes);
+        count_operations<std::deque<T>,  FilledHalfErased, Shrink>("deque_shrink",  sizes);
+        count_operations<plf::colony<T>, FilledHalfErased, Shrink>("colony_shrink", sizes);
+
+        count_operations<std::vector<T>, FilledRandom, EraseFront>("vector_erase_front", sizes);
+        count_operations<std::deque<T>,  FilledRandom, EraseFront>("deque_erase_front",  sizes);
+        count_operations<plf::colony<T>, FilledRandomInsert, EraseFront>("colony_erase_front", sizes);
+
+        count_operations<plf::colony<T>, FilledRandomInsert, Reshape>("colony_reshape", sizes);
+    }
+};
+
+// Many small containers, the size is the number of elements per container
+
+template<typename T>
+struct bench_small_fill {
+    static void run(){
+        new_graph<T>("small_fill", "us");
+
+        auto sizes = {1, 2, 4, 6, 8, 10, 12, 14, 16};
+        bench<std::vector<std::vector<T>>,     microseconds, EmptyBatch, FillBatch>("vector", sizes);
+        bench<std::vector<std::deque<T>>,      microseconds, EmptyBatch, FillBatch>("deque",  sizes);
+        bench<std::vector<std::list<T>>,       microseconds, EmptyBatch, FillBatch>("list",   sizes);
+        bench<std::vector<small_vector<T>>,    microseconds, EmptyBatch, FillBatch>("small_vector", sizes);
+        bench<std::vector<small_vector<T, 4>>, microseconds, EmptyBatch, FillBatch>("small_vector_4", sizes);
+
+        bench<std::vector<policy_vector<T, vector_policy::inline_capacity<16>>>, microseconds, EmptyBatch, FillBatch>("policy_vector_16", sizes);
+        bench<std::vector<policy_vector<T, vector_policy::inline_capacity<4>>>,  microseconds, EmptyBatch, FillBatch>("policy_vector_4", sizes);
+        bench<std::vector<policy_vector<T, vector_policy::inline_capacity<4>, vector_policy::allocator<arena_allocator>>>, microseconds, EmptyBatch, FillBatch>("policy_vector_4_arena", sizes);
+    }
+};
+
+template<typename T>
+struct bench_small_copy {
+    static void run(){
+        new_graph<T>("small_copy", "us");
+
+        auto sizes = {1, 2, 4, 6, 8, 10, 12, 14, 16};
+        bench<std::vector<std::vector<T>>,     microseconds, FilledRandomBatch, CopyBatch>("vector", sizes);
+        bench<std::vector<std::deque<T>>,      microseconds, FilledRandomBatch, CopyBatch>("deque",  sizes);
+        bench<std::vector<std::list<T>>,       microseconds, FilledRandomBatch, CopyBatch>("list",   sizes);
+        bench<std::vector<small_vector<T>>,    microseconds, FilledRandomBatch, CopyBatch>("small_vector", sizes);
+        bench<std::vector<small_vector<T, 4>>, microseconds, FilledRandomBatch, CopyBatch>("small_vector_4", sizes);
+
+        bench<std::vector<policy_vector<T, vector_policy::inline_capacity<16>>>, microseconds, FilledRandomBatch, CopyBatch>("policy_vector_16", sizes);
+        bench<std::vector<policy_vector<T, vector_policy::inline_capacity<4>>>,  microseconds, FilledRandomBatch, CopyBatch>("policy_vector_4", sizes);
+        bench<std::vector<policy_vector<T, vector_policy::inline_capacity<4>, vector_policy::allocator<arena_allocator>>>, microseconds, FilledRandomBatch, CopyBatch>("policy_vector_4_arena", sizes);
+    }
+};
+
+template<typename T>
+struct bench_small_destroy {
+    static void run(){
+        new_graph<T>("small_destroy", "us");
+
+        auto sizes = {1, 2, 4, 6, 8, 10, 12, 14, 16};
+        bench<std::vector<std::vector<T>>,     microseconds, FilledRandomBatch, DestroyBatch>("vector", sizes);
+        bench<std::vector<std::deque<T>>,      microseconds, FilledRandomBatch, DestroyBatch>("deque",  sizes);
+        bench<std::vector<std::list<T>>,       microseconds, FilledRandomBatch, DestroyBatch>("list",   sizes);
+        bench<std::vector<small_vector<T>>,    microseconds, FilledRandomBatch, DestroyBatch>("small_vector", sizes);
+        bench<std::vector<small_vector<T, 4>>, microseconds, FilledRandomBatch, DestroyBatch>("small_vector_4", sizes);
+
+        bench<std::vector<policy_vector<T, vector_policy::inline_capacity<16>>>, microseconds, FilledRandomBatch, DestroyBatch>("policy_vector_16", sizes);
+        bench<std::vector<policy_vector<T, vector_policy::inline_capacity<4>>>,  microseconds, FilledRandomBatch, DestroyBatch>("policy_vector_4", sizes);
+        bench<std::vector<policy_vector<T, vector_policy::inline_capacity<4>, vector_policy::allocator<arena_allocator>>>, microseconds, FilledRandomBatch, DestroyBatch>("policy_vector_4_arena", sizes);
     }
 };
 
@@ -285,6 +631,36 @@ struct bench_sort {
         bench<std::deque<T>,  milliseconds, FilledRandom, Sort>("deque",  sizes);
         bench<plf::colony<T>,  milliseconds, FilledRandomInsert, Sort>("colony",  sizes);
         bench<plf::colony<T>,  milliseconds, FilledRandomInsert, TimSort>("colony_timsort",  sizes);
+        bench<plf::colony<T>,  milliseconds, FilledRandomInsert, ParallelTimSort>("colony_par_timsort",  sizes);
+        bench<plf::colony<T>,  milliseconds, FilledRandomInsert, KeySort>("colony_keysort",  sizes);
+
+        bench<std::vector<T>, milliseconds, FilledRandom, parallel<2>::Sort>("vector_par_2", sizes);
+        bench<std::vector<T>, milliseconds, FilledRandom, parallel<4>::Sort>("vector_par_4", sizes);
+        bench<std::vector<T>, milliseconds, FilledRandom, parallel<0>::Sort>("vector_par", sizes);
+        bench<std::deque<T>,  milliseconds, FilledRandom, parallel<0>::Sort>("deque_par",  sizes);
+        bench<plf::colony<T>, milliseconds, FilledRandomInsert, parallel<0>::Sort>("colony_par", sizes);
+
+#ifdef ARTICLES_HAS_EXECUTION
+        bench<std::vector<T>, milliseconds, FilledRandom, ExecutionSort>("vector_par_unseq", sizes);
+#endif
+    }
+};
+
+// Natural runs are common in real data, the timsorts should take advantage of them
+
+template<typename T>
+struct bench_sort_nearly_sorted {
+    static void run(){
+        new_graph<T>("sort_nearly_sorted", "ms");
+
+        auto sizes = {100000, 200000, 300000, 400000, 500000, 600000, 700000, 800000, 900000, 1000000};
+        bench<std::vector<T>,  milliseconds, FilledNearlySorted, Sort>("vector", sizes);
+        bench<std::vector<T>,  milliseconds, FilledNearlySorted, parallel<0>::Sort>("vector_par", sizes);
+        bench<std::vector<T>,  milliseconds, FilledNearlySorted, TimSort>("vector_timsort", sizes);
+        bench<std::vector<T>,  milliseconds, FilledNearlySorted, ParallelTimSort>("vector_par_timsort", sizes);
+        bench<plf::colony<T>,  milliseconds, FilledNearlySorted, Sort>("colony", sizes);
+        bench<plf::colony<T>,  milliseconds, FilledNearlySorted, TimSort>("colony_timsort", sizes);
+        bench<plf::colony<T>,  milliseconds, FilledNearlySorted, ParallelTimSort>("colony_par_timsort", sizes);
     }
 };
 
@@ -310,10 +686,28 @@ struct bench_number_crunching {
         bench<std::vector<T>, milliseconds, Empty, RandomSortedInsert>("vector", sizes);
         bench<std::list<T>,   milliseconds, Empty, RandomSortedInsert>("list",   sizes);
         bench<std::deque<T>,  milliseconds, Empty, RandomSortedInsert>("deque",  sizes);
+        bench<unrolled_list<T>, milliseconds, Empty, RandomSortedInsert>("unrolled_list", sizes);
+        bench<flat_btree<T>,  milliseconds, Empty, RandomSortedInsert>("flat_btree", sizes);
+        bench<std::multiset<T>, milliseconds, Empty, RandomSortedInsert>("multiset", sizes);
+        bench<std::vector<T>, milliseconds, Empty, RandomSortedInsertBinary>("vector_bsearch", sizes);
+        bench<std::deque<T>,  milliseconds, Empty, RandomSortedInsertBinary>("deque_bsearch",  sizes);
+        bench<indexed_list<T>, milliseconds, Empty, RandomSortedInsertBinary>("list_skiplist", sizes);
         // colony is unordered
     }
 };
 
+// The linear containers are way too slow for these sizes
+template<typename T>
+struct bench_number_crunching_large {
+    static void run(){
+        new_graph<T>("number_crunching_large", "ms");
+
+        auto sizes = {100000, 200000, 300000, 400000, 500000, 600000, 700000, 800000, 900000, 1000000};
+        bench<flat_btree<T>,  milliseconds, Empty, RandomSortedInsert>("flat_btree", sizes);
+        bench<std::multiset<T>, milliseconds, Empty, RandomSortedInsert>("multiset", sizes);
+    }
+};
+
 template<typename T>
 struct bench_erase_1 {
     static void run(){
@@ -366,6 +760,62 @@ struct bench_erase_50 {
     }
 };
 
+// Traversal of a container where Percent% of the elements have been erased,
+// the colony is also visited by blocks of contiguous elements
+
+template<std::size_t Percent>
+struct bench_erased {
+    template<typename T>
+    struct type {
+        static void run(){
+            auto sizes = {10000, 20000, 30000, 40000, 50000, 60000, 70000, 80000, 90000, 100000};
+
+            new_graph<T>("traversal_erased_" + std::to_string(Percent), "us");
+            bench<std::vector<T>,  microseconds, erased<Percent>::template Filled, Iterate>("vector", sizes);
+            bench<plf::colony<T>,  microseconds, erased<Percent>::template Filled, Iterate>("colony", sizes);
+            bench<plf::colony<T>,  microseconds, erased<Percent>::template Filled, BlockIterate>("colony_block", sizes);
+
+            new_graph<T>("write_erased_" + std::to_string(Percent), "us");
+            bench<std::vector<T>,  microseconds, erased<Percent>::template Filled, Write>("vector", sizes);
+            bench<plf::colony<T>,  microseconds, erased<Percent>::template Filled, Write>("colony", sizes);
+            bench<plf::colony<T>,  microseconds, erased<Percent>::template Filled, BlockWrite>("colony_block", sizes);
+        }
+    };
+};
+
+// Traversal of a container after one of the RandomErase policies, the colony
+// is also visited by blocks of contiguous elements
+
+template<std::size_t Percent, template<class> class Erase>
+struct bench_random_erased {
+    template<typename T>
+    struct type {
+        static void run(){
+            auto sizes = {10000, 20000, 30000, 40000, 50000, 60000, 70000, 80000, 90000, 100000};
+
+            new_graph<T>("traversal_random_erase" + std::to_string(Percent), "us");
+            bench<std::vector<T>,  microseconds, erased_by<Erase>::template Filled, Iterate>("vector", sizes);
+            bench<plf::colony<T>,  microseconds, erased_by<Erase>::template Filled, Iterate>("colony", sizes);
+            bench<plf::colony<T>,  microseconds, erased_by<Erase>::template Filled, BlockIterate>("colony_block", sizes);
+        }
+    };
+};
+
+template<std::size_t Percent>
+struct bench_find_erased {
+    template<typename T>
+    struct type {
+        static void run(){
+            auto sizes = {10000, 20000, 30000, 40000, 50000, 60000, 70000, 80000, 90000, 100000};
+
+            new_graph<T>("find_erased_" + std::to_string(Percent), "us");
+            bench<std::vector<T>,  microseconds, erased<Percent>::template Filled, Find>("vector", sizes);
+            bench<plf::colony<T>,  microseconds, erased<Percent>::template Filled, Find>("colony", sizes);
+            bench<plf::colony<T>,  microseconds, erased<Percent>::template Filled, BlockFind>("colony_block", sizes);
+        }
+    };
+};
+
 template<typename T>
 struct bench_traversal {
     static void run(){
@@ -376,6 +826,10 @@ struct bench_traversal {
         bench<std::list<T>,   microseconds, FilledRandom, Iterate>("list",   sizes);
         bench<std::deque<T>,  microseconds, FilledRandom, Iterate>("deque",  sizes);
         bench<plf::colony<T>, microseconds, FilledRandomInsert, Iterate>("colony",  sizes);
+        bench<unrolled_list<T>, microseconds, FilledRandom, Iterate>("unrolled_list", sizes);
+
+        bench_policy_vectors<T, microseconds, FilledRandom, Iterate>(sizes);
+        bench_soa_vector<T, microseconds, FilledRandomTuple, Iterate>(sizes, nullptr);
     }
 };
 
@@ -389,6 +843,9 @@ struct bench_write {
         bench<std::list<T>,   microseconds, FilledRandom, Write>("list",   sizes);
         bench<std::deque<T>,  microseconds, FilledRandom, Write>("deque",  sizes);
         bench<plf::colony<T>, microseconds, FilledRandomInsert, Write>("colony",  sizes);
+
+        bench_policy_vectors<T, microseconds, FilledRandom, Write>(sizes);
+        bench_soa_vector<T, microseconds, FilledRandomTuple, WriteTuple>(sizes, nullptr);
     }
 };
 
@@ -405,6 +862,180 @@ struct bench_find {
     }
 };
 
+// Colony configuration: skipfield type, minimum and maximum group sizes and
+// reservation of the first group before filling
+
+template<typename Skipfield, std::size_t MinGroup, std::size_t MaxGroup, bool Reserve>
+struct colony_config {
+    static_assert(MaxGroup <= std::numeric_limits<Skipfield>::max(), "The groups are limited by the skipfield type");
+
+    template<typename T>
+    using colony = plf::colony<T, std::allocator<T>, Skipfield>;
+
+    static std::string name(){
+        return std::string(sizeof(Skipfield) == sizeof(unsigned short) ? "short" : "int")
+            + "_" + std::to_string(MinGroup) + "_" + std::to_string(MaxGroup) + (Reserve ? "_reserve" : "");
+    }
+
+    template<typename T>
+    static colony<T> make(const std::vector<T>& values){
+        colony<T> container;
+        container.change_group_sizes(MinGroup, MaxGroup);
+
+        if(Reserve){
+            container.reserve(std::min(values.size(), MaxGroup));
+        }
+
+        for(auto& value : values){
+            container.insert(value);
+        }
+
+        return container;
+    }
+};
+
+// Run all the colony operations on the configuration, record the time of each
+// of them and return the total time. The write pass is the iteration over the
+// remaining elements.
+
+template<typename T, template<class> class Erase, typename Config>
+std::size_t sweep_colony(const std::vector<T>& values, std::size_t index){
+    using colony = typename Config::template colony<T>;
+
+    std::size_t fill = 0, erase = 0, write = 0, sort = 0, destruction = 0;
+
+    for(std::size_t i=0; i<REPEAT; ++i) {
+        Clock::time_point t0 = Clock::now();
+
+        std::unique_ptr<colony> container(new colony(Config::template make<T>(values)));
+
+        Clock::time_point t1 = Clock::now();
+
+        Erase<colony>::run(*container, values.size());
+
+        Clock::time_point t2 = Clock::now();
+
+        Write<colony>::run(*container, values.size());
+
+        Clock::time_point t3 = Clock::now();
+
+        container->sort();
+
+        Clock::time_point t4 = Clock::now();
+
+        container.reset();
+
+        Clock::time_point t5 = Clock::now();
+
+        fill        += elapsed<microseconds>(t0, t1);
+        erase       += elapsed<microseconds>(t1, t2);
+        write       += elapsed<microseconds>(t2, t3);
+        sort        += elapsed<microseconds>(t3, t4);
+        destruction += elapsed<microseconds>(t4, t5);
+    }
+
+    // The groups are ordered numerically, they start with the index of the configuration
+    auto group = std::to_string(index) + "_" + Config::name();
+
+    graphs::new_result("fill",        group, fill / REPEAT);
+    graphs::new_result("erase",       group, erase / REPEAT);
+    graphs::new_result("write",       group, write / REPEAT);
+    graphs::new_result("sort",        group, sort / REPEAT);
+    graphs::new_result("destruction", group, destruction / REPEAT);
+
+    auto total = (fill + erase + write + sort + destruction) / REPEAT;
+
+    graphs::new_result("total", group, total);
+
+    return total;
+}
+
+template<typename T, template<class> class Erase>
+void sweep_colony_configs(const std::vector<T>&, std::size_t, std::string&, std::size_t&){
+    //End of recursion
+}
+
+template<typename T, template<class> class Erase, typename Config, typename ...Configs>
+void sweep_colony_configs(const std::vector<T>& values, std::size_t index, std::string& best, std::size_t& best_total){
+    auto total = sweep_colony<T, Erase, Config>(values, index);
+
+    if(best.empty() || total < best_total){
+        best = Config::name();
+        best_total = total;
+    }
+
+    sweep_colony_configs<T, Erase, Configs...>(values, index + 1, best, best_total);
+}
+
+// The best configuration of a sweep, for one erase rate and one element size
+
+struct colony_sweep_result {
+    std::size_t percent;
+    std::size_t element_size;
+    std::string best;
+    std::size_t total;
+};
+
+std::vector<colony_sweep_result> colony_sweep_results;
+
+// Sweep of the colony configurations, to tune the colony for each element size
+// and each rate of erasures
+
+template<std::size_t Percent, template<class> class Erase>
+struct bench_colony_sweep {
+    template<typename T>
+    struct type {
+        static void run(){
+            new_graph<T>("colony_sweep_erase" + std::to_string(Percent), "us");
+
+            auto values = FilledRandom<std::vector<T>>::make(100000);
+
+            std::string best;
+            std::size_t best_total = 0;
+
+            sweep_colony_configs<T, Erase,
+                colony_config<unsigned short, 8,    1024,  false>,
+                colony_config<unsigned short, 8,    1024,  true>,
+                colony_config<unsigned short, 64,   8192,  false>,
+                colony_config<unsigned short, 64,   8192,  true>,
+                colony_config<unsigned short, 8,    65535, false>,
+                colony_config<unsigned short, 8,    65535, true>,
+                colony_config<unsigned short, 1024, 65535, false>,
+                colony_config<unsigned short, 1024, 65535, true>,
+                colony_config<unsigned int,   8,    1024,  false>,
+                colony_config<unsigned int,   64,   8192,  false>,
+                colony_config<unsigned int,   8,    65535, false>,
+                colony_config<unsigned int,   8,    65535, true>,
+                colony_config<unsigned int,   1024, 65535, false>,
+                colony_config<unsigned int,   8,    1048576, false>,
+                colony_config<unsigned int,   1024, 1048576, true>
+            >(values, 0, best, best_total);
+
+            FilledRandom<std::vector<T>>::clean();
+
+            colony_sweep_results.push_back({Percent, sizeof(T), best, best_total});
+
+            std::cout << "Best colony configuration for " << demangle(typeid(T).name()) << " with "
+                << Percent << "% erased: " << best << std::endl;
+        }
+    };
+};
+
+// The total of the best configuration for each element size, once all the
+// element sizes have been swept
+
+template<std::size_t Percent>
+void colony_sweep_best(){
+    std::string title("colony_sweep_best_erase" + std::to_string(Percent));
+    graphs::new_graph(tag(title), title, "us");
+
+    for(auto& result : colony_sweep_results){
+        if(result.percent == Percent){
+            graphs::new_result("best", std::to_string(result.element_size), result.total);
+        }
+    }
+}
+
 //Launch the benchmark
 
 template<typename ...Types>
@@ -417,16 +1048,55 @@ void bench_all(){
     bench_types<bench_write,            Types...>();
     bench_types<bench_random_insert,    Types...>();
     bench_types<bench_random_remove,    Types...>();
+    bench_types<bench_bulk_fill_back,   Types...>();
+    bench_types<bench_bulk_insert,      Types...>();
+    bench_types<bench_bulk_erase,       Types...>();
     bench_types<bench_sort,             Types...>();
+    bench_types<bench_sort_nearly_sorted, Types...>();
     bench_types<bench_destruction,      Types...>();
     bench_types<bench_erase_1,          Types...>();
     bench_types<bench_erase_10,         Types...>();
     bench_types<bench_erase_25,         Types...>();
     bench_types<bench_erase_50,         Types...>();
+    bench_types<bench_traversal,        Types...>();
+    bench_types<bench_erased<0>::template type,  Types...>();
+    bench_types<bench_erased<1>::template type,  Types...>();
+    bench_types<bench_erased<10>::template type, Types...>();
+    bench_types<bench_erased<25>::template type, Types...>();
+    bench_types<bench_erased<50>::template type, Types...>();
+    bench_types<bench_random_erased<10, RandomErase10>::template type, Types...>();
+    bench_types<bench_random_erased<25, RandomErase25>::template type, Types...>();
+    bench_types<bench_random_erased<50, RandomErase50>::template type, Types...>();
 
     // The following are really slow so run only for limited set of data
     bench_types<bench_find,             TrivialSmall, TrivialMedium, TrivialLarge>();
+    bench_types<bench_find_erased<0>::template type,  TrivialSmall, TrivialMedium, TrivialLarge>();
+    bench_types<bench_find_erased<1>::template type,  TrivialSmall, TrivialMedium, TrivialLarge>();
+    bench_types<bench_find_erased<10>::template type, TrivialSmall, TrivialMedium, TrivialLarge>();
+    bench_types<bench_find_erased<25>::template type, TrivialSmall, TrivialMedium, TrivialLarge>();
+    bench_types<bench_find_erased<50>::template type, TrivialSmall, TrivialMedium, TrivialLarge>();
     bench_types<bench_number_crunching, TrivialSmall, TrivialMedium>();
+    bench_types<bench_number_crunching_large, TrivialSmall, TrivialMedium>();
+
+    // The inline storage of the small containers is too big for the larger types
+    bench_types<bench_small_fill,       TrivialSmall, TrivialMedium, TrivialLarge, NonTrivialStringMovable, NonTrivialStringMovableNoExcept, NonTrivialArray<32>>();
+    bench_types<bench_small_copy,       TrivialSmall, TrivialMedium, TrivialLarge, NonTrivialStringMovable, NonTrivialStringMovableNoExcept, NonTrivialArray<32>>();
+    bench_types<bench_small_destroy,    TrivialSmall, TrivialMedium, TrivialLarge, NonTrivialStringMovable, NonTrivialStringMovableNoExcept, NonTrivialArray<32>>();
+
+    // The colony configurations are only swept for the trivial types
+    bench_types<bench_colony_sweep<10, RandomErase10>::template type, TrivialSmall, TrivialMedium, TrivialLarge, TrivialHuge>();
+    bench_types<bench_colony_sweep<25, RandomErase25>::template type, TrivialSmall, TrivialMedium, TrivialLarge, TrivialHuge>();
+    bench_types<bench_colony_sweep<50, RandomErase50>::template type, TrivialSmall, TrivialMedium, TrivialLarge, TrivialHuge>();
+    colony_sweep_best<10>();
+    colony_sweep_best<25>();
+    colony_sweep_best<50>();
+
+    // Only the counted types can report their copies and moves
+    bench_types<bench_compaction,       CountedStringMovable, CountedStringMovableNoExcept>();
+
+    // The relocatable type only matters when the storage grows or is shifted
+    bench_types<bench_fill_back,        NonTrivialStringRelocatable>();
+    bench_types<bench_random_insert,    NonTrivialStringRelocatable>();
 }
 
 int main(){